@@ -0,0 +1,138 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ *
+ * Measures the loading of a large atlas and sprite sheet, and the lookup of
+ * their Frames by name and by index.
+ *
+ * Usage: `frame_lookup_benchmark [frames] [iterations]`
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/texture/systems/texture.hpp"
+#include "../src/texture/components/texture.hpp"
+#include "../src/texture/components/source.hpp"
+
+using namespace Zen;
+
+namespace Zen {
+extern entt::registry g_registry;
+}
+
+/**
+ * Creates a Texture with a single Source of the given size, without loading
+ * any image.
+ */
+static Entity CreateEmptyTexture (std::string key, int width, int height)
+{
+	Entity texture = g_registry.create();
+	auto& tx = g_registry.emplace<Components::Texture>(texture);
+	tx.key = key;
+	tx.frameTotal = 0;
+	tx.firstFrame = entt::null;
+
+	Entity source = g_registry.create();
+	auto& src = g_registry.emplace<Components::TextureSource>(source);
+	src.texture = texture;
+	src.source = key;
+	src.index = 0;
+	src.resolution = 1.;
+	src.sdlTexture = nullptr;
+	src.width = width;
+	src.height = height;
+
+	return texture;
+}
+
+static double Elapsed (std::chrono::steady_clock::time_point start)
+{
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+	return elapsed.count();
+}
+
+int main (int argc, char **argv)
+{
+	int frames = (argc > 1) ? std::atoi(argv[1]) : 10000;
+	int iterations = (argc > 2) ? std::atoi(argv[2]) : 100;
+
+	if (frames < 1 || iterations < 1)
+	{
+		std::cerr << "Usage: " << argv[0] << " [frames] [iterations]" << std::endl;
+		return 1;
+	}
+
+	const int size = 8192;
+	const int cell = 16;
+	const int columns = size / cell;
+
+	std::vector<std::string> names;
+	names.reserve(frames);
+
+	for (int i = 0; i < frames; i++)
+		names.emplace_back("atlas/frame_" + std::to_string(i) + ".png");
+
+	// Load
+	Entity atlas = CreateEmptyTexture("atlas", size, size);
+	Entity sheet = CreateEmptyTexture("sheet", size, size);
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < frames; i++)
+		AddFrame(atlas, names[i], 0, (i % columns) * cell, (i / columns) * cell, cell, cell);
+
+	double atlasLoad = Elapsed(start);
+
+	start = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < frames; i++)
+		AddFrame(sheet, i, 0, (i % columns) * cell, (i / columns) * cell, cell, cell);
+
+	double sheetLoad = Elapsed(start);
+
+	// Look up in a random order, as a scene would
+	std::vector<int> lookups(frames);
+
+	std::mt19937 random(42);
+	for (auto& index : lookups)
+		index = random() % frames;
+
+	std::size_t found = 0;
+
+	start = std::chrono::steady_clock::now();
+
+	for (int k = 0; k < iterations; k++)
+		for (int index : lookups)
+			found += GetFrame(atlas, names[index]) != entt::null;
+
+	double nameLookup = Elapsed(start);
+
+	start = std::chrono::steady_clock::now();
+
+	for (int k = 0; k < iterations; k++)
+		for (int index : lookups)
+			found += GetFrame(sheet, index) != entt::null;
+
+	double indexLookup = Elapsed(start);
+
+	double lookupCount = static_cast<double>(frames) * iterations;
+
+	std::cout << frames << " frames, " << iterations << " iterations, "
+		<< found << " found" << std::endl;
+	std::cout << std::fixed << std::setprecision(3)
+		<< "atlas load:   " << atlasLoad << " ms" << std::endl
+		<< "sheet load:   " << sheetLoad << " ms" << std::endl
+		<< "name lookup:  " << nameLookup * 1e6 / lookupCount << " ns" << std::endl
+		<< "index lookup: " << indexLookup * 1e6 / lookupCount << " ns" << std::endl;
+
+	return (found == static_cast<std::size_t>(lookupCount) * 2) ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ *
+ * Replays a frame saved by `Renderer::saveCommands`, to measure the cost of
+ * its rendering in isolation from the rest of the engine.
+ *
+ * Usage: `render_replay_benchmark file [iterations] [software]`
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "../src/renderer/command_buffer.hpp"
+
+using namespace Zen;
+
+int main (int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " file [iterations] [software]" << std::endl;
+		return 1;
+	}
+
+	int iterations = (argc > 2) ? std::atoi(argv[2]) : 1000;
+	bool software = (argc > 3) && std::strcmp(argv[3], "software") == 0;
+
+	if (software)
+		SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+
+	if (SDL_Init(SDL_INIT_VIDEO) < 0)
+	{
+		std::cerr << "Could not initialize SDL: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+
+	// Never drawn to, the commands draw to a target of their output size
+	SDL_Window *window = SDL_CreateWindow("Replay", SDL_WINDOWPOS_UNDEFINED,
+			SDL_WINDOWPOS_UNDEFINED, 1, 1, SDL_WINDOW_HIDDEN);
+
+	// No vsync, only the rendering is measured
+	SDL_Renderer *renderer = window ? SDL_CreateRenderer(window, -1,
+			(software ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED) |
+			SDL_RENDERER_TARGETTEXTURE) : nullptr;
+
+	if (!renderer)
+	{
+		std::cerr << "Could not create the renderer: " << SDL_GetError() << std::endl;
+		SDL_Quit();
+		return 1;
+	}
+
+	RenderCommandBuffer commands;
+	commands.setRenderer(renderer);
+
+	if (!commands.load(argv[1]))
+	{
+		SDL_DestroyRenderer(renderer);
+		SDL_DestroyWindow(window);
+		SDL_Quit();
+		return 1;
+	}
+
+	// Warm up the driver caches
+	int failures = commands.execute();
+	SDL_RenderFlush(renderer);
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; i++)
+	{
+		commands.execute();
+		SDL_RenderFlush(renderer);
+	}
+
+	// Wait for the GPU to finish
+	Uint32 pixel = 0;
+	SDL_Rect area {0, 0, 1, 1};
+	SDL_RenderReadPixels(renderer, &area, SDL_PIXELFORMAT_ARGB8888, &pixel, sizeof(pixel));
+
+	std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+	std::cout << commands.size() << " commands, "
+		<< commands.getOutputWidth() << "x" << commands.getOutputHeight() << " output, "
+		<< iterations << " iterations, " << failures << " failed" << std::endl;
+	std::cout << std::fixed << std::setprecision(3)
+		<< elapsed.count() / iterations << " us per frame" << std::endl;
+
+	commands.unload();
+
+	SDL_DestroyRenderer(renderer);
+	SDL_DestroyWindow(window);
+	SDL_Quit();
+
+	return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ *
+ * Micro-benchmark of the batch transform matrix functions, comparing every
+ * instruction set supported by the CPU against the scalar path.
+ *
+ * Usage: `transform_matrix_batch_benchmark [count] [iterations]`
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/systems/transform_matrix_batch.hpp"
+
+using namespace Zen;
+
+/**
+ * The inputs shared by every run, so that each instruction set processes the
+ * same data.
+ */
+struct Inputs
+{
+	std::vector<double> x, y, rotation, scaleX, scaleY;
+
+	std::vector<SDL_FPoint> sizes;
+
+	Components::TransformMatrix camera;
+};
+
+/**
+ * The outputs of a run, kept to check them against the scalar path.
+ */
+struct Outputs
+{
+	TransformMatrixArray matrices;
+
+	std::vector<DecomposedMatrix> decomposed;
+
+	std::vector<SDL_FPoint> quads;
+};
+
+static const char* LevelName (SIMD_LEVEL level)
+{
+	switch (level)
+	{
+		case SIMD_LEVEL::AVX2:
+			return "avx2";
+		case SIMD_LEVEL::SSE2:
+			return "sse2";
+		default:
+			return "scalar";
+	}
+}
+
+/**
+ * Runs a function `iterations` times and returns the average time per
+ * element, in nanoseconds.
+ */
+template <typename F>
+static double Measure (std::size_t count, int iterations, F&& function)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; i++)
+		function();
+
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+	return elapsed.count() / (static_cast<double>(count) * iterations);
+}
+
+static void Run (SIMD_LEVEL level, const Inputs& in, Outputs& out, std::size_t count, int iterations)
+{
+	SetSimdLevel(level);
+
+	out.matrices.resize(count);
+	out.decomposed.resize(count);
+	out.quads.resize(count * 4);
+
+	double itrs = Measure(count, iterations, [&] () {
+		ApplyITRS(&out.matrices, in.x.data(), in.y.data(), in.rotation.data(),
+				in.scaleX.data(), in.scaleY.data(), 0, count);
+	});
+
+	// Each iteration multiplies the result of the previous one, use a copy
+	TransformMatrixArray scratch = out.matrices;
+	double multiply = Measure(count, iterations, [&] () {
+		Multiply(in.camera, &scratch, 0, count);
+	});
+
+	TransformMatrixArray pairs = out.matrices;
+	double multiplyPairs = Measure(count, iterations, [&] () {
+		Multiply(&pairs, out.matrices, 0, count);
+	});
+
+	// Keep a single application of the camera for the checks
+	Multiply(in.camera, &out.matrices, 0, count);
+
+	double decompose = Measure(count, iterations, [&] () {
+		DecomposeMatrix(out.matrices, out.decomposed.data(), 0, count);
+	});
+
+	double quads = Measure(count, iterations, [&] () {
+		TransformQuads(out.matrices, in.sizes.data(), {1.5f, 1.5f}, {8.f, 4.f},
+				out.quads.data(), 0, count);
+	});
+
+	std::cout << std::setw(8) << LevelName(level)
+		<< std::fixed << std::setprecision(3)
+		<< std::setw(12) << itrs
+		<< std::setw(12) << multiply
+		<< std::setw(12) << multiplyPairs
+		<< std::setw(12) << decompose
+		<< std::setw(12) << quads
+		<< std::endl;
+}
+
+/**
+ * Returns the largest difference between two runs.
+ */
+static double Compare (const Outputs& a, const Outputs& b)
+{
+	double error = 0.;
+
+	for (std::size_t i = 0; i < a.matrices.size(); i++)
+	{
+		error = std::max(error, std::abs(a.matrices.a[i] - b.matrices.a[i]));
+		error = std::max(error, std::abs(a.matrices.e[i] - b.matrices.e[i]));
+		error = std::max(error, std::abs(a.decomposed[i].rotation - b.decomposed[i].rotation));
+		error = std::max(error, std::abs(a.decomposed[i].scaleY - b.decomposed[i].scaleY));
+	}
+
+	for (std::size_t i = 0; i < a.quads.size(); i++)
+	{
+		error = std::max(error, static_cast<double>(std::abs(a.quads[i].x - b.quads[i].x)));
+		error = std::max(error, static_cast<double>(std::abs(a.quads[i].y - b.quads[i].y)));
+	}
+
+	return error;
+}
+
+int main (int argc, char **argv)
+{
+	std::size_t count = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+	int iterations = (argc > 2) ? std::atoi(argv[2]) : 100;
+
+	std::mt19937 random(42);
+	std::uniform_real_distribution<double> position(-2000., 2000.);
+	std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+	std::uniform_real_distribution<double> scale(0.25, 4.);
+	std::uniform_real_distribution<float> size(1.f, 256.f);
+
+	Inputs in;
+	for (std::size_t i = 0; i < count; i++)
+	{
+		in.x.emplace_back(position(random));
+		in.y.emplace_back(position(random));
+		in.rotation.emplace_back(angle(random));
+		in.scaleX.emplace_back(scale(random));
+		in.scaleY.emplace_back(scale(random));
+		in.sizes.push_back({size(random), size(random)});
+	}
+
+	in.camera = {1.25, 0., 0., 1.25, -320., -180.};
+
+	SIMD_LEVEL best = SetSimdLevel(SIMD_LEVEL::AVX2);
+
+	std::cout << count << " matrices, " << iterations << " iterations, ns per matrix" << std::endl;
+	std::cout << std::setw(8) << "level"
+		<< std::setw(12) << "itrs"
+		<< std::setw(12) << "multiply"
+		<< std::setw(12) << "pairs"
+		<< std::setw(12) << "decompose"
+		<< std::setw(12) << "quads"
+		<< std::endl;
+
+	Outputs scalar;
+	Run(SIMD_LEVEL::SCALAR, in, scalar, count, iterations);
+
+	for (SIMD_LEVEL level : {SIMD_LEVEL::SSE2, SIMD_LEVEL::AVX2})
+	{
+		if (static_cast<int>(level) > static_cast<int>(best))
+			break;
+
+		Outputs out;
+		Run(level, in, out, count, iterations);
+
+		std::cout << std::setw(8) << "" << " max difference with scalar: "
+			<< std::scientific << Compare(scalar, out) << std::endl;
+	}
+
+	return 0;
+}
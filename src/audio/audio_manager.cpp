@@ -87,6 +87,25 @@ void AudioManager::addAudioShort (std::string key_, std::string filename_)
 	load_ogg(filename_, &buffers[key_]);
 }
 
+void AudioManager::addAudioShort (std::string key_, const AudioData& audio_)
+{
+	// Check if key is used
+	auto itSh_ = buffers.find(key_);
+	if (itSh_ != buffers.end()) {
+		MessageError("The key \"", key_, "\" is already in use for a short");
+		return;
+	}
+
+	auto itSt_ = streamSources.find(key_);
+	if (itSt_ != streamSources.end()) {
+		MessageError("The key \"", key_, "\" is already in use for a stream");
+		return;
+	}
+
+	buffers[key_] = {};
+	upload_ogg(audio_, &buffers[key_]);
+}
+
 void AudioManager::addAudioStream (std::string key_, std::string filename_)
 {
 	// Check if key is used	for a stream
@@ -19,6 +19,7 @@
 #include "tools/al_utility.hpp"
 #include "tools/alc_utility.hpp"
 #include "types/audio_buffer.hpp"
+#include "types/audio_data.hpp"
 #include "types/audio_stream_data.hpp"
 
 namespace Zen {
@@ -53,6 +54,17 @@ public:
 
 	void addAudioShort (std::string key, std::string filename);
 
+	/**
+	 * Adds a short from samples decoded ahead of time, only copying them to
+	 * an OpenAL buffer.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param key The unique key of the short.
+	 * @param audio The decoded samples.
+	 */
+	void addAudioShort (std::string key, const AudioData& audio);
+
 	void addAudioStream (std::string key, std::string filename);
 
 	Entity add (std::string buffer);
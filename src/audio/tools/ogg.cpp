@@ -3,6 +3,7 @@
 #include <cstring>
 #include <iostream>
 #include <limits>
+#include <utility>
 #include <vector>
 #include "../../utils/assert.hpp"
 #include "../../utils/messages.hpp"
@@ -359,9 +360,9 @@ int update_stream_ogg (AudioStreamData *audioStream)
 	return retValue;
 }
 
-int load_ogg (const std::string& filename, AudioBuffer *audioBuffer)
+int decode_ogg (const std::string& filename, AudioData *audioData)
 {
-	audioBuffer->filename = filename;
+	audioData->filename = filename;
 
 	std::ifstream audioFile(filename, std::ios::binary);
 	if (!audioFile.is_open())
@@ -400,8 +401,6 @@ int load_ogg (const std::string& filename, AudioBuffer *audioBuffer)
 	std::uint32_t sampleRate = vorbisInfo->rate;
 	double duration = ov_time_total(&oggVorbisFile, -1);
 
-	ZEN_AL_CALL(alGenBuffers, 1, &audioBuffer->buffer);
-
 	if (audioFile.eof())
 	{
 		std::cerr << "ERROR: Already reached EOF without loading data" << std::endl;
@@ -480,12 +479,39 @@ int load_ogg (const std::string& filename, AudioBuffer *audioBuffer)
 		return -1;
 	}
 
+	audioData->samples = std::move(data);
+	audioData->format = format;
+	audioData->sampleRate = sampleRate;
+
+	return 0;
+}
+
+int upload_ogg (const AudioData& audioData, AudioBuffer *audioBuffer)
+{
+	audioBuffer->filename = audioData.filename;
+
+	ZEN_AL_CALL(alGenBuffers, 1, &audioBuffer->buffer);
+
 	// Copy data into the OpenAL buffer
-	ZEN_AL_CALL(alBufferData, audioBuffer->buffer, format, data.data(), rawSize, sampleRate);
+	ZEN_AL_CALL(alBufferData, audioBuffer->buffer, audioData.format,
+			audioData.samples.data(), audioData.samples.size(), audioData.sampleRate);
 
 	return 0;
 }
 
+int load_ogg (const std::string& filename, AudioBuffer *audioBuffer)
+{
+	AudioData audioData;
+
+	if (decode_ogg(filename, &audioData) < 0)
+	{
+		audioBuffer->filename = filename;
+		return -1;
+	}
+
+	return upload_ogg(audioData, audioBuffer);
+}
+
 int rewind_stream_ogg (AudioStreamData *audioStream)
 {
 	// Stop the source
@@ -20,6 +20,7 @@
 #include "al_utility.hpp"
 #include "alc_utility.hpp"
 #include "../types/audio_buffer.hpp"
+#include "../types/audio_data.hpp"
 #include "../types/audio_stream_data.hpp"
 
 #define OGG_AL_NUM_BUFFERS 4
@@ -37,6 +38,31 @@ namespace Zen {
  */
 int load_ogg (const std::string& filename, AudioBuffer *audioData);
 
+/**
+ * Decodes an audio file without touching OpenAL, so it can run on any
+ * thread.
+ *
+ * @since 0.0.0
+ *
+ * @param filename The audio file to decode.
+ * @param audioData A pointer to the AudioData object to store the samples in.
+ *
+ * @return `0` if no problem occured, or a negative number otherwise.
+ */
+int decode_ogg (const std::string& filename, AudioData *audioData);
+
+/**
+ * Copies decoded samples to a new OpenAL buffer.
+ *
+ * @since 0.0.0
+ *
+ * @param audioData The decoded samples.
+ * @param audioBuffer A pointer to the AudioBuffer object to store the audio in.
+ *
+ * @return `0` if no problem occured, or a negative number otherwise.
+ */
+int upload_ogg (const AudioData& audioData, AudioBuffer *audioBuffer);
+
 int setup_stream_ogg (const std::string& filename, AudioStreamData *audioStream);
 
 /**
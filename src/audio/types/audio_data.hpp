@@ -0,0 +1,31 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_AUDIO_TYPES_AUDIODATA_HPP
+#define ZEN_AUDIO_TYPES_AUDIODATA_HPP
+
+#include <string>
+#include <vector>
+#include "AL/al.h"
+
+namespace Zen {
+
+/**
+ * The samples of an audio file, decoded but not yet copied to an OpenAL
+ * buffer.
+ */
+struct AudioData
+{
+	std::string filename;
+	std::vector<char> samples;
+	ALenum format;
+	ALsizei sampleRate;
+};
+
+}	// namespace Zen
+
+#endif
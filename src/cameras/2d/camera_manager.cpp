@@ -8,6 +8,7 @@
 #include "camera_manager.hpp"
 
 #include <memory>
+#include <algorithm>
 #include "systems/camera.hpp"
 #include "../../scene/scene_manager.hpp"
 #include "../../scene/scene.hpp"
@@ -28,9 +29,15 @@
 #include "../../systems/input.hpp"
 #include "../../systems/alpha.hpp"
 #include "../../systems/renderable.hpp"
+#include "../../systems/dirty.hpp"
+#include "../../components/renderable.hpp"
+#include "../../components/cull.hpp"
+#include "../../components/render_cache.hpp"
+#include "../../systems/render_cache.hpp"
 
 namespace Zen {
 
+extern entt::registry g_registry;
 extern ScaleManager g_scale;
 
 CameraManager::CameraManager (Scene* scene_)
@@ -257,21 +264,121 @@ void CameraManager::render (
 		Renderer& renderer_,
 		DisplayList& displayList_)
 {
+	auto index_ = displayList_.getSpatialIndex();
+
+	// The cameras querying the spatial index don't need the shared pass over
+	// the whole display list
+	bool fullPass_ = false;
+
+	for (auto camera_ : cameras)
+	{
+		auto cull_ = g_registry.try_get<Components::Cull>(camera_);
+
+		if (!index_ || !cull_ || !cull_->value)
+		{
+			fullPass_ = true;
+			break;
+		}
+	}
+
+	if (fullPass_)
+		computeVisibility(displayList_.getChildren());
+
 	for (auto camera_ : cameras)
 	{
 		if (GetVisible(camera_) && GetAlpha(camera_) > 0)
 		{
 			PreRender(camera_);
 
-			auto visibleChildren_ = getVisibleChildren(displayList_.getChildren(), camera_);
+			// A cached camera draws its last render until it is due again
+			auto cache_ = g_registry.try_get<Components::RenderCache>(camera_);
+
+			if (cache_ && !UpdateRenderCache(camera_, time))
+			{
+				renderer_.drawCache(*cache_);
+
+				continue;
+			}
+
+			int id_ = GetId(camera_);
+
+			if (index_ && Cull(camera_, *index_, &cameraChildren))
+			{
+				// Only the Game Objects the camera can see are tested
+				auto end_ = std::remove_if(cameraChildren.begin(), cameraChildren.end(),
+						[camera_] (Entity child_) {
+							return !WillRender(child_, camera_);
+						});
+
+				cameraChildren.erase(end_, cameraChildren.end());
+			}
+			else
+			{
+				cameraChildren.clear();
+
+				for (std::size_t i_ = 0; i_ < visibleChildren.size(); i_++)
+				{
+					if (visibleMasks[i_] & id_)
+						cameraChildren.emplace_back(visibleChildren[i_]);
+				}
+			}
+
+			renderer_.extract(cameraChildren, camera_, packet, true);
 
-			renderer_.render(*scene, visibleChildren_, camera_);
+			bool cached_ = cache_ && renderer_.beginCache(packet, *cache_);
+
+			renderer_.prepare(packet);
+
+			renderer_.cullOccluded(packet);
+
+			renderer_.sortRecords(packet);
+
+			renderer_.render(*scene, packet);
+
+			if (cached_)
+			{
+				renderer_.endCache(*cache_);
+				renderer_.drawCache(*cache_);
+			}
+
+			SetDirty(camera_, false);
+		}
+	}
+}
+
+void CameraManager::computeVisibility (const std::vector<Entity>& children_)
+{
+	visibleChildren.clear();
+	visibleMasks.clear();
+
+	// Every camera ID is a different bit
+	int cameraMask_ = 0;
+	for (auto camera_ : cameras)
+		cameraMask_ |= GetId(camera_);
+
+	for (auto child_ : children_)
+	{
+		if (child_ == entt::null)
+			continue;
+
+		auto renderable_ = g_registry.try_get<Components::Renderable>(child_);
+
+		if (!renderable_ || renderable_->flags != 0b1111)
+			continue;
+
+		// The filter holds the IDs of the cameras ignoring the Game Object
+		int mask_ = cameraMask_ & ~renderable_->filter;
+
+		if (mask_)
+		{
+			visibleChildren.emplace_back(child_);
+			visibleMasks.emplace_back(mask_);
 		}
 	}
 }
 
 std::vector<Entity> CameraManager::getVisibleChildren (
-		std::vector<Entity> children_,
+		const std::vector<Entity>& children_,
 		Entity camera_)
 {
 	std::vector<Entity> visible_;
@@ -296,6 +403,8 @@ Entity CameraManager::resetAll ()
 
 void CameraManager::update (Uint32 time_, Uint32 delta_)
 {
+	time = time_;
+
 	for (auto& camera_ : cameras)
 		UpdateCamera(camera_, time_, delta_);
 }
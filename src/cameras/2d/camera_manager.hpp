@@ -21,6 +21,7 @@
 #include "../../input/pointer.hpp"
 #include "../../gameobjects/display_list.hpp"
 #include "../../renderer/renderer.fwd.hpp"
+#include "../../renderer/types/render_packet.hpp"
 
 namespace Zen {
 
@@ -125,6 +126,46 @@ public:
 	 */
 	Entity def;
 
+	/**
+	 * The render packet each Camera is extracted into before being rendered.
+	 * It is kept between frames to reuse its memory.
+	 *
+	 * @since 0.0.0
+	 */
+	RenderPacket packet;
+
+	/**
+	 * The Game Objects of the display list visible by at least one Camera, in
+	 * display order, computed once per frame by `computeVisibility`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entity> visibleChildren;
+
+	/**
+	 * The IDs of the Cameras that can see each Game Object of
+	 * `visibleChildren`, OR'ed together.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<int> visibleMasks;
+
+	/**
+	 * The Game Objects to extract for the Camera being rendered, kept to reuse
+	 * its memory.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entity> cameraChildren;
+
+	/**
+	 * The time of the last update, in milliseconds, used to pace the Cameras
+	 * with a render rate.
+	 *
+	 * @since 0.0.0
+	 */
+	Uint32 time = 0;
+
 	/**
 	 * A pointer to the "start" event listener, to later remove it.
 	 *
@@ -290,6 +331,21 @@ public:
 	 */
 	void render (Renderer& renderer_, DisplayList& displayList_);
 
+	/**
+	 * Tests every Game Object of a display list against all the Cameras at
+	 * once, and stores those visible by at least one of them in
+	 * `visibleChildren`, along with the IDs of these Cameras in
+	 * `visibleMasks`.
+	 *
+	 * This is the `WillRender` test, done with a single registry lookup per
+	 * Game Object instead of one per Game Object and Camera.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param children_ The Game Objects to test, in display order.
+	 */
+	void computeVisibility (const std::vector<Entity>& children_);
+
 	/**
 	 * Takes an array of Game Objects and a Camera and returns a new array
 	 * containing only those Game Objects that pass the `willRender` test
@@ -304,7 +360,7 @@ public:
 	 * render against the given Camera.
 	 */
 	std::vector<Entity> getVisibleChildren (
-			std::vector<Entity> children_,
+			const std::vector<Entity>& children_,
 			Entity camera_);
 
 	/**
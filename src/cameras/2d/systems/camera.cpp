@@ -8,6 +8,7 @@
 #include "camera.hpp"
 
 #include <map>
+#include <cmath>
 #include "../../../utils/assert.hpp"
 #include "../../../event/event_emitter.hpp"
 #include "../../../scale/scale_manager.hpp"
@@ -44,7 +45,9 @@
 #include "../../../components/container_item.hpp"
 #include "../../../components/bounds.hpp"
 #include "../../../components/mid_point.hpp"
+#include "../../../gameobjects/spatial_index.hpp"
 #include "../../../systems/scroll.hpp"
+#include "../../../systems/render_cache.hpp"
 #include "../../../systems/bounds.hpp"
 #include "../../../systems/transform_matrix.hpp"
 #include "../../../systems/position.hpp"
@@ -57,9 +60,6 @@ namespace Zen {
 extern entt::registry g_registry;
 extern ScaleManager g_scale;
 
-// Temporary vector, to not recreate a new one each culling pass
-static std::vector<Entity> culledObjects;
-
 // Map: Camera - Object List
 static std::map<Entity, std::vector<Entity>> renderLists;
 
@@ -199,7 +199,7 @@ void DestroyCamera (Entity entity)
 
 	//g _event.removeAllListeners(entity);
 
-	culledObjects.clear();
+	RemoveRenderCache(entity);
 
 	auto it = renderLists.find(entity);
 	if (it != renderLists.end())
@@ -218,9 +218,10 @@ std::vector<Entity>* GetRenderList (Entity camera)
 	return &renderLists[camera];
 }
 
-std::vector<Entity> Cull (
+void Cull (
 		Entity entity,
-		std::vector<Entity> renderableEntities)
+		const std::vector<Entity>& renderableEntities,
+		std::vector<Entity> *output)
 {
 	auto [cull, matrix, position, size, scroll] = g_registry.try_get<
 		Components::Cull,
@@ -232,8 +233,7 @@ std::vector<Entity> Cull (
 
 	ZEN_ASSERT(cull && matrix && position && size && scroll, "The entity has no 'Cull', 'TransformMatrix', 'Position', 'Size' or 'Scroll' component.");
 
-	if (!cull->value)
-		return renderableEntities;
+	output->clear();
 
 	double mva = matrix->a;
 	double mvb = matrix->b;
@@ -243,8 +243,11 @@ std::vector<Entity> Cull (
 	// First Invert Matrix
 	double determinant = (mva * mvd) - (mvb * mvc);
 
-	if (!determinant)
-		return renderableEntities;
+	if (!cull->value || !determinant)
+	{
+		output->assign(renderableEntities.begin(), renderableEntities.end());
+		return;
+	}
 
 	double mve = matrix->e;
 	double mvf = matrix->f;
@@ -254,11 +257,6 @@ std::vector<Entity> Cull (
 	double cullLeft = position->x;
 	double cullRight = position->x + size->width;
 
-	determinant = 1.f / determinant;
-
-	// Clear the temporary matrix
-	culledObjects.clear();
-
 	for (auto& object : renderableEntities)
 	{
 		auto [oSize, oPosition, oScrollFactor, oOrigin, oItem] = g_registry.try_get<
@@ -269,7 +267,8 @@ std::vector<Entity> Cull (
 			Components::ContainerItem
 			>(object);
 
-		if (oSize && oPosition && oScrollFactor && oOrigin && oItem)
+		// Objects inside a Container are positioned relative to it
+		if (oSize && oPosition && oScrollFactor && oOrigin && !(oItem && oItem->parent != entt::null))
 		{
 			auto objectW = oSize->width;
 			auto objectH = oSize->height;
@@ -282,16 +281,45 @@ std::vector<Entity> Cull (
 
 			if ((tw > cullLeft && tx < cullRight) && (th > cullTop && ty < cullBottom))
 			{
-				culledObjects.emplace_back(object);
+				output->emplace_back(object);
 			}
 		}
 		else
 		{
-			culledObjects.emplace_back(object);
+			output->emplace_back(object);
 		}
 	}
+}
+
+bool Cull (Entity entity, SpatialIndex& index, std::vector<Entity> *output)
+{
+	auto [cull, worldView, rotation] = g_registry.try_get<
+		Components::Cull,
+		Components::WorldView,
+		Components::Rotation
+		>(entity);
+
+	ZEN_ASSERT(cull && worldView, "The entity has no 'Cull' or 'WorldView' component.");
+
+	if (!cull->value)
+		return false;
+
+	Rectangle area = worldView->worldView;
+
+	// A rotated Camera sees past its World View, use a square containing it
+	// whatever the angle, as long as the Camera rotates around a point of it
+	if (rotation && rotation->value != 0.)
+	{
+		double radius = std::hypot(area.width, area.height);
+		double centerX = area.x + area.width / 2.;
+		double centerY = area.y + area.height / 2.;
+
+		SetTo(&area, centerX - radius, centerY - radius, radius * 2., radius * 2.);
+	}
+
+	index.query(area, output);
 
-	return culledObjects;
+	return true;
 }
 
 Math::Vector2 GetWorldPoint (Entity entity, int x, int y)
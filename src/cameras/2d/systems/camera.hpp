@@ -14,6 +14,8 @@
 
 namespace Zen {
 
+class SpatialIndex;
+
 /**
  * @since 0.0.0
  *
@@ -46,16 +48,39 @@ void AddToRenderList (Entity entity, Entity child);
 std::vector<Entity>* GetRenderList (Entity camera);
 
 /**
- * Takes a vector of Game Objects pointers and returns a new vector featuring 
- * only those objects visible by this camera.
+ * Takes a vector of Game Objects and fills another one with only those
+ * objects visible by this camera.
+ *
+ * This tests every Game Object, see the SpatialIndex overload for large
+ * scenes.
+ *
+ * @since 0.0.0
+ *
+ * @param renderableEntities The Game Objects to cull.
+ * @param output The vector to fill with the Game Objects visible to this
+ * Camera. It is cleared first.
+ */
+void Cull (Entity entity, const std::vector<Entity>& renderableEntities, std::vector<Entity> *output);
+
+/**
+ * Fills a vector with the Game Objects of a spatial index that may be
+ * visible by this camera, in display order.
+ *
+ * The index is queried with the World View of the Camera, grown to contain
+ * it whatever the rotation of the Camera, so the cost depends on the number
+ * of visible Game Objects rather than on the size of the world. The results
+ * are conservative, the renderer still skips the quads that end up outside
+ * of the viewport.
  *
  * @since 0.0.0
  *
- * @param renderableObjects_ An array of Game Objects to cull.
+ * @param index The spatial index of the display list.
+ * @param output The vector to fill. It is cleared first.
  *
- * @return A vector of Game Objects visible to this Camera.
+ * @return `false` if culling is disabled on this Camera, in which case
+ * `output` is left untouched.
  */
-std::vector<Entity> Cull (Entity entity, std::vector<Entity> renderableEntities);
+bool Cull (Entity entity, SpatialIndex& index, std::vector<Entity> *output);
 
 /**
  * Converts the given `x` and `y` coordinates into World space, based on this Cameras transform.
@@ -9,6 +9,7 @@
 #define ZEN_COMPONENTS_MASK_HPP
 
 #include "../ecs/entity.hpp"
+#include "../geom/types/rectangle.hpp"
 
 namespace Zen {
 namespace Components {
@@ -24,6 +25,15 @@ struct Mask
 	 * @since 0.0.0
 	 */
 	bool fixed = false;
+
+	/**
+	 * An axis-aligned rectangle in world space, used instead of a Game Object
+	 * when `mask` is null. It is applied as a clip rectangle, without any
+	 * offscreen rendering. Empty if not set.
+	 *
+	 * @since 0.0.0
+	 */
+	Rectangle rect;
 };
 
 }	// namespace Components
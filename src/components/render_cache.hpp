@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_RENDERCACHE_HPP
+#define ZEN_COMPONENTS_RENDERCACHE_HPP
+
+#include <SDL2/SDL.h>
+
+namespace Zen {
+namespace Components {
+
+/**
+ * Lets a Camera render into its own texture less often, or at a lower
+ * resolution, than the rest of the game. The texture is drawn in place of
+ * the Camera on the frames it isn't rendered.
+ *
+ * @since 0.0.0
+ */
+struct RenderCache
+{
+	/**
+	 * The Camera is rendered once every `interval` frames.
+	 */
+	int interval = 1;
+
+	/**
+	 * If above 0, the Camera is rendered this many times per second instead
+	 * of following `interval`.
+	 */
+	double rate = 0.;
+
+	/**
+	 * The size of the texture relative to the Camera viewport, between 0
+	 * and 1.
+	 */
+	double resolution = 1.;
+
+	/**
+	 * The texture the Camera is rendered into.
+	 */
+	SDL_Texture *texture = nullptr;
+
+	int width = 0,
+		height = 0;
+
+	/**
+	 * The area of the window the texture is drawn to.
+	 */
+	SDL_Rect viewport {0, 0, 0, 0};
+
+	/**
+	 * The number of frames since the last render.
+	 */
+	int frames = 0;
+
+	/**
+	 * The time of the last render, in milliseconds.
+	 */
+	Uint32 time = 0;
+
+	/**
+	 * Whether the texture holds a render of the Camera.
+	 */
+	bool valid = false;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_RENDERTEXTURE_HPP
+#define ZEN_COMPONENTS_RENDERTEXTURE_HPP
+
+#include <SDL2/SDL.h>
+#include <string>
+
+namespace Zen {
+namespace Components {
+
+/**
+ * A texture Game Objects can be rendered to, registered in the Texture
+ * Manager so that it can be drawn like any other texture.
+ *
+ * The texture is owned by the Texture Manager.
+ *
+ * @since 0.0.0
+ */
+struct RenderTexture
+{
+	SDL_Texture *texture = nullptr;
+
+	int width = 0,
+		height = 0;
+
+	/**
+	 * The key of the texture in the Texture Manager.
+	 */
+	std::string key;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_SPATIALITEM_HPP
+#define ZEN_COMPONENTS_SPATIALITEM_HPP
+
+namespace Zen {
+
+class SpatialIndex;
+
+namespace Components {
+
+/**
+ * The spatial index a Game Object is registered in, so that its bounds can be
+ * updated when its transform changes.
+ *
+ * @since 0.0.0
+ */
+struct SpatialItem
+{
+	SpatialIndex *index = nullptr;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
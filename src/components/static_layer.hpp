@@ -0,0 +1,62 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_STATICLAYER_HPP
+#define ZEN_COMPONENTS_STATICLAYER_HPP
+
+#include <vector>
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+namespace Components {
+
+/**
+ * A Render Texture drawing a group of Game Objects once, and reusing the
+ * result until one of them changes.
+ *
+ * @since 0.0.0
+ */
+struct StaticLayer
+{
+	/**
+	 * The Camera rendering the members into the texture. It isn't part of
+	 * any Camera Manager.
+	 */
+	Entity camera = entt::null;
+
+	/**
+	 * The Game Objects of the layer, in render order. Their position is
+	 * relative to the top-left corner of the layer.
+	 */
+	std::vector<Entity> members;
+
+	/**
+	 * Whether the texture must be rendered again.
+	 */
+	bool dirty = true;
+};
+
+/**
+ * The static layer a Game Object is drawn by.
+ *
+ * @since 0.0.0
+ */
+struct LayerMember
+{
+	Entity layer = entt::null;
+
+	/**
+	 * The camera filter of the Game Object before it joined the layer,
+	 * restored when it leaves it.
+	 */
+	int filter = 0;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
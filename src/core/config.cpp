@@ -7,6 +7,8 @@
 
 #include "config.hpp"
 
+#include <algorithm>
+
 #include "../display/color.hpp"
 
 namespace Zen {
@@ -128,6 +130,106 @@ GameConfig& GameConfig::setClearBeforeRender (bool flag)
 	return *this;
 }
 
+GameConfig& GameConfig::setParallelRender (bool flag, unsigned int threads)
+{
+	parallelRender = flag;
+	renderThreads = threads;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setRenderOnChange (bool flag, unsigned int timeout)
+{
+	renderOnChange = flag;
+	idleTimeout = timeout;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setRenderTargetPool (unsigned int idleTime, unsigned int debounce)
+{
+	renderTargetIdleTime = idleTime;
+	renderTargetDebounce = debounce;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setInternalResolution (int width, int height, bool linear)
+{
+	internalResolution = true;
+	internalWidth = width;
+	internalHeight = height;
+	internalLinear = linear;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setRenderBackend (RENDER_BACKEND backend)
+{
+	renderBackend = backend;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setDeferredRendering (bool flag)
+{
+	deferredRendering = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setPipelinedRendering (bool flag)
+{
+	pipelinedRendering = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setTextureSort (bool flag, unsigned int window)
+{
+	textureSort = flag;
+	textureSortWindow = window;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setOverdrawCulling (bool flag)
+{
+	overdrawCulling = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setAtlasCache (bool flag)
+{
+	atlasCache = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setAsyncLoading (bool flag, unsigned int budget)
+{
+	asyncLoading = flag;
+	loaderBudget = budget;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setTextureBudget (unsigned int megabytes)
+{
+	textureBudget = megabytes;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setAlphaMask (int depth, int threshold)
+{
+	alphaMaskDepth = (depth == 1) ? 1 : 8;
+	alphaMaskThreshold = std::clamp(threshold, 0, 255);
+
+	return *this;
+}
+
 GameConfig& GameConfig::setBackgroundColor (unsigned int color)
 {
 	SetHex(&backgroundColor, color);
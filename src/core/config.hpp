@@ -15,6 +15,7 @@
 
 #include "../scale/scale_modes.hpp"
 #include "../display/types/color.hpp"
+#include "../enums/render_backend.hpp"
 
 #include "../scene/scene.fwd.hpp"
 
@@ -228,6 +229,182 @@ public:
 	 */
 	GameConfig& setHiddenDelta (unsigned int delta);
 
+	/**
+	 * Prepares the sprites of each Camera on a pool of worker threads.
+	 *
+	 * @since 0.0.0
+	 * @param flag If `true`, the render preparation is multithreaded.
+	 * @param threads The number of worker threads. If `0`, one less than the
+	 * number of hardware threads is used.
+	 */
+	GameConfig& setParallelRender (bool flag = true, unsigned int threads = 0);
+
+	/**
+	 * Only renders the frames where something changed. When nothing did, the
+	 * game loop waits for an input event instead of rendering and presenting
+	 * the same frame again.
+	 *
+	 * Changes are tracked by the component setters, see `MarkFrameDirty`.
+	 *
+	 * @since 0.0.0
+	 * @param flag If `true`, unchanged frames are skipped.
+	 * @param timeout The longest time to wait for an event, in
+	 * milliseconds, so that the Scenes still update while idle.
+	 */
+	GameConfig& setRenderOnChange (bool flag = true, unsigned int timeout = 100);
+
+	/**
+	 * Sets when the temporary render targets of the masks are freed.
+	 *
+	 * They are created the first time a mask needs them and shared by every
+	 * Camera, then destroyed once unused for `idleTime`. After the window is
+	 * resized, none is destroyed until it stopped changing for `debounce`.
+	 *
+	 * @since 0.0.0
+	 * @param idleTime How long a render target must be unused before being
+	 * destroyed, in milliseconds.
+	 * @param debounce How long the size must be stable after a resize, in
+	 * milliseconds.
+	 */
+	GameConfig& setRenderTargetPool (unsigned int idleTime = 2000, unsigned int debounce = 250);
+
+	/**
+	 * Renders the whole game to a render target of a fixed resolution, which
+	 * is upscaled to the window once per frame.
+	 *
+	 * Every Camera draws at this resolution instead of the one of the
+	 * window, which saves fill rate on large displays, and keeps pixel art
+	 * on a single pixel grid. The Pointer coordinates are unaffected.
+	 *
+	 * @since 0.0.0
+	 * @param width The width of the render target, or `0` for the game width.
+	 * @param height The height of the render target, or `0` for the game
+	 * height.
+	 * @param linear If `true`, the upscale uses linear filtering instead of
+	 * nearest neighbor.
+	 */
+	GameConfig& setInternalResolution (int width = 0, int height = 0, bool linear = false);
+
+	/**
+	 * Selects how the frames are rendered.
+	 *
+	 * The `SOFTWARE` and `NONE` backends need neither a GPU nor a display:
+	 * SDL runs its dummy video driver and the window is never shown.
+	 *
+	 * @since 0.0.0
+	 * @param backend The render backend.
+	 */
+	GameConfig& setRenderBackend (RENDER_BACKEND backend);
+
+	/**
+	 * Records the calls to the SDL renderer made while rendering a frame,
+	 * and executes them all at once at the end of the frame.
+	 *
+	 * @since 0.0.0
+	 * @param flag If `true`, the render commands are deferred.
+	 */
+	GameConfig& setDeferredRendering (bool flag = true);
+
+	/**
+	 * Updates the scenes of a frame on a worker thread, while the frame
+	 * rendered before is submitted to the GPU on the main thread.
+	 *
+	 * The frames are deferred: each one is recorded after its update, on the
+	 * main thread, and only its render commands are kept for the next step.
+	 * The events, the input, the audio and the scene operations stay on the
+	 * main thread. The updates must not call SDL themselves: the textures the
+	 * engine creates or loads are created on the main thread for them.
+	 *
+	 * Frames with a snapshot, a capture or saved commands are submitted
+	 * right away, as without pipelining.
+	 *
+	 * @since 0.0.0
+	 * @param flag If `true`, the update and the rendering overlap.
+	 */
+	GameConfig& setPipelinedRendering (bool flag = true);
+
+	/**
+	 * Groups the sprites of equal depth by texture and blend mode, so that
+	 * they are drawn in fewer batches.
+	 *
+	 * A sprite only moves back to an earlier group if it overlaps none of
+	 * the sprites drawn between them, so the frame looks the same.
+	 *
+	 * @since 0.0.0
+	 * @param flag If `true`, the sprites are sorted by texture.
+	 * @param window The number of groups a sprite can move back across.
+	 */
+	GameConfig& setTextureSort (bool flag = true, unsigned int window = 16);
+
+	/**
+	 * Skips the sprites entirely covered by opaque sprites drawn after them
+	 * by the same camera.
+	 *
+	 * The Texture Manager reads the pixels of every texture it adds to flag
+	 * the frames that are fully opaque. Only unrotated, unmasked sprites of
+	 * such frames, at full alpha and with the `NORMAL`, `BLEND`,
+	 * `SOURCE_OVER` or `COPY` blend mode, cover others.
+	 *
+	 * @since 0.0.0
+	 * @param flag If `true`, the covered sprites are skipped.
+	 */
+	GameConfig& setOverdrawCulling (bool flag = true);
+
+	/**
+	 * Loads the frames of the Texture Atlases from a binary copy of their
+	 * JSON data, saved next to it with the `.bin` extension.
+	 *
+	 * The copy is made the first time an atlas is loaded, and again whenever
+	 * its JSON file changes.
+	 *
+	 * @since 0.0.0
+	 * @param flag If `true`, the atlases are loaded from their binary copy.
+	 */
+	GameConfig& setAtlasCache (bool flag = true);
+
+	/**
+	 * Loads the files of the Scenes in the background, while the game keeps
+	 * running.
+	 *
+	 * Reading and decoding the files happens on worker threads. Only the
+	 * creation of the textures and audio buffers is left to the Scene, for
+	 * up to `budget` milliseconds per frame. A Scene is created once all of
+	 * its files are loaded.
+	 *
+	 * @since 0.0.0
+	 * @param flag If `true`, the files are loaded in the background.
+	 * @param budget The time spent creating resources per frame, in
+	 * milliseconds.
+	 */
+	GameConfig& setAsyncLoading (bool flag = true, unsigned int budget = 4);
+
+	/**
+	 * Limits the memory used by the textures loaded from files.
+	 *
+	 * Once a frame is rendered, the textures least recently drawn are
+	 * released until they fit in the budget. A released texture is loaded
+	 * again from its file the next time it is drawn. Render textures are
+	 * never released.
+	 *
+	 * @since 0.0.0
+	 * @param megabytes The texture budget in megabytes, `0` for no limit.
+	 */
+	GameConfig& setTextureBudget (unsigned int megabytes);
+
+	/**
+	 * Sets how the alpha masks of the textures loaded with an alpha cache
+	 * are packed, for pixel-perfect hit tests.
+	 *
+	 * An 8-bit mask keeps the alpha value of every pixel. A 1-bit mask only
+	 * keeps whether it reaches the threshold, and reads as `255` or `0`, in
+	 * an eighth of the memory.
+	 *
+	 * @since 0.0.0
+	 * @param depth The bits per pixel, `1` or `8`.
+	 * @param threshold The lowest alpha of a set pixel in a 1-bit mask.
+	 */
+	GameConfig& setAlphaMask (int depth, int threshold = 128);
+
 	// Member variables
 	/**
 	 * The width of the window, in pixels.
@@ -361,6 +538,169 @@ public:
 	 */
 	bool clearBeforeRender = true;
 
+	/**
+	 * Whether the transform and culling of the sprites is split across worker
+	 * threads before being drawn.
+	 *
+	 * @since 0.0.0
+	 */
+	bool parallelRender = false;
+
+	/**
+	 * The number of worker threads used when `parallelRender` is set. If `0`,
+	 * one less than the number of hardware threads is used.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int renderThreads = 0;
+
+	/**
+	 * Whether the frames where nothing changed are skipped.
+	 *
+	 * @since 0.0.0
+	 */
+	bool renderOnChange = false;
+
+	/**
+	 * The longest time the game loop waits for an event when a frame is
+	 * skipped, in milliseconds.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int idleTimeout = 100;
+
+	/**
+	 * How long a pooled render target must be unused before being destroyed,
+	 * in milliseconds.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int renderTargetIdleTime = 2000;
+
+	/**
+	 * How long the size of the renderer must be stable after a resize before
+	 * the pooled render targets are trimmed, in milliseconds.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int renderTargetDebounce = 250;
+
+	/**
+	 * Whether the game renders to a render target upscaled to the window.
+	 *
+	 * @since 0.0.0
+	 */
+	bool internalResolution = false;
+
+	/**
+	 * The size of the internal render target, `0` meaning the game size.
+	 *
+	 * @since 0.0.0
+	 */
+	int internalWidth = 0;
+
+	/**
+	 * @since 0.0.0
+	 */
+	int internalHeight = 0;
+
+	/**
+	 * Whether the internal render target is upscaled with linear filtering.
+	 *
+	 * @since 0.0.0
+	 */
+	bool internalLinear = false;
+
+	/**
+	 * How the frames are rendered.
+	 *
+	 * @since 0.0.0
+	 */
+	RENDER_BACKEND renderBackend = RENDER_BACKEND::ACCELERATED;
+
+	/**
+	 * Whether the render commands of a frame are recorded, then executed at
+	 * the end of the frame.
+	 *
+	 * @since 0.0.0
+	 */
+	bool deferredRendering = false;
+
+	/**
+	 * Whether the scenes are updated on a worker thread while the previous
+	 * frame is submitted.
+	 *
+	 * @since 0.0.0
+	 */
+	bool pipelinedRendering = false;
+
+	/**
+	 * Whether the sprites of equal depth are grouped by texture and blend
+	 * mode before being drawn.
+	 *
+	 * @since 0.0.0
+	 */
+	bool textureSort = false;
+
+	/**
+	 * The number of groups a sprite can move back across when
+	 * `textureSort` is set.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int textureSortWindow = 16;
+
+	/**
+	 * Whether the sprites covered by opaque sprites are skipped.
+	 *
+	 * @since 0.0.0
+	 */
+	bool overdrawCulling = false;
+
+	/**
+	 * Whether the Texture Atlases are loaded from their binary copy.
+	 *
+	 * @since 0.0.0
+	 */
+	bool atlasCache = false;
+
+	/**
+	 * Whether the files of the Scenes are loaded in the background.
+	 *
+	 * @since 0.0.0
+	 */
+	bool asyncLoading = false;
+
+	/**
+	 * The time a loading Scene spends creating resources per frame, in
+	 * milliseconds, when `asyncLoading` is set.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int loaderBudget = 4;
+
+	/**
+	 * The memory the textures loaded from files can use, in megabytes. `0`
+	 * for no limit.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int textureBudget = 0;
+
+	/**
+	 * The bits per pixel of the alpha masks, `1` or `8`.
+	 *
+	 * @since 0.0.0
+	 */
+	int alphaMaskDepth = 8;
+
+	/**
+	 * The lowest alpha of a set pixel in a 1-bit alpha mask.
+	 *
+	 * @since 0.0.0
+	 */
+	int alphaMaskThreshold = 128;
+
 	/**
 	 * The background color used by the renderer to clear the screen.
 	 *
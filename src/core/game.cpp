@@ -21,6 +21,7 @@
 #include "../input/keyboard/keyboard_manager.hpp"
 #include "../audio/audio_manager.hpp"
 #include "../text/text_manager.hpp"
+#include "../systems/dirty.hpp"
 
 namespace Zen {
 
@@ -134,13 +135,32 @@ void Game::step (Uint32 time_, Uint32 delta_)
 	// Mostly meant for user-land code and plugins
 	g_event.emit("step", time_, delta_);
 
-	// Update the Scene Manager and all active Scenes
-	g_scene.update(time_, delta_);
+	// Scenes are added, started, moved and loaded on the main thread
+	g_scene.processQueue();
+	g_scene.updateLoaders();
+
+	// Update the Scene Manager and all active Scenes. With pipelined
+	// rendering, this runs on a worker while the last frame is submitted
+	g_renderer.overlap([time_, delta_] () {
+		g_scene.update(time_, delta_);
+	});
+
 	g_audio.update(time_, delta_);
 
 	// Final event before rendering starts
 	g_event.emit("post-step", time_, delta_);
 
+	// Nothing changed since the last frame, wait for an event instead of
+	// rendering and presenting it again
+	if (config.renderOnChange && !IsFrameDirty())
+	{
+		SDL_WaitEventTimeout(nullptr, config.idleTimeout);
+		return;
+	}
+
+	// Anything changing from now on is drawn by the next frame
+	SetFrameDirty(false);
+
 	// Run the Pre-Renderer (Clearing the window, setting background colors, etc...)
 	g_input.preRender(time_, delta_);
 	g_renderer.preRender();
@@ -153,6 +173,9 @@ void Game::step (Uint32 time_, Uint32 delta_)
 	// The Post-Render call. Tidies up loose end, takes snapshots, etc...
 	g_renderer.postRender();
 
+	// Release the textures over the budget, not the ones just drawn
+	g_texture.enforceBudget(g_renderer.frameCount);
+
 	// Final event before the step repeats. Last chance to do anything before
 	// it all starts again.
 	g_event.emit("post-render", time_, delta_);
@@ -163,6 +186,8 @@ void Game::headlessStep (Uint32 time_, Uint32 delta_)
 	// Managers
 	g_event.emit("pre-step", time_, delta_);
 	g_event.emit("step", time_, delta_);
+	g_scene.processQueue();
+	g_scene.updateLoaders();
 	g_scene.update(time_, delta_);
 	g_audio.update(time_, delta_);
 
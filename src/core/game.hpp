@@ -97,6 +97,10 @@ public:
 	 * in turn, via the Scene Manager. It will then render each Scene in turn, via 
 	 * the Renderer. This process emits "prerender" and "postrender" events.
 	 *
+	 * If GameConfig::renderOnChange is set and nothing changed since the last
+	 * frame, the rendering is skipped along with these events, and the step
+	 * waits for an SDL event for at most GameConfig::idleTimeout.
+	 *
 	 * @since 0.0.0
 	 * @param time The total time since SDL was initialized in
 	 * milliseconds (SDL_GetTicks).
@@ -10,6 +10,7 @@
 #include "../window/window.hpp"
 #include "../input/mouse/mouse_manager.hpp"
 #include "../input/keyboard/keyboard_manager.hpp"
+#include "../systems/dirty.hpp"
 
 namespace Zen {
 
@@ -23,6 +24,9 @@ void Game::handleSDLEvents ()
 
 	while (SDL_PollEvent(&event_))
 	{
+		// Any event may change what is drawn
+		MarkFrameDirty();
+
 		switch (event_.type)
 		{
 			// Misc
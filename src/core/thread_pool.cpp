@@ -0,0 +1,141 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "thread_pool.hpp"
+
+#include <algorithm>
+
+namespace Zen {
+
+ThreadPool::~ThreadPool ()
+{
+	stop();
+}
+
+void ThreadPool::start (unsigned int count_)
+{
+	if (!workers.empty())
+		return;
+
+	if (count_ == 0)
+	{
+		unsigned int hardware_ = std::thread::hardware_concurrency();
+		count_ = (hardware_ > 1) ? hardware_ - 1 : 0;
+	}
+
+	stopping = false;
+
+	for (unsigned int i_ = 0; i_ < count_; i_++)
+		workers.emplace_back(&ThreadPool::work, this);
+}
+
+void ThreadPool::stop ()
+{
+	{
+		std::lock_guard<std::mutex> lock_(mutex);
+		stopping = true;
+	}
+
+	condition.notify_all();
+
+	for (auto& worker_ : workers)
+		worker_.join();
+
+	workers.clear();
+}
+
+std::size_t ThreadPool::size () const
+{
+	return workers.size();
+}
+
+void ThreadPool::enqueue (std::function<void()> task_)
+{
+	if (workers.empty())
+	{
+		task_();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_(mutex);
+		tasks.emplace_back(std::move(task_));
+	}
+
+	condition.notify_one();
+}
+
+void ThreadPool::parallelFor (
+		std::size_t count_,
+		const std::function<void(std::size_t, std::size_t, std::size_t)>& task_,
+		std::size_t minChunk_)
+{
+	if (count_ == 0)
+		return;
+
+	std::size_t chunks_ = std::min(
+			workers.size() + 1,
+			(count_ + minChunk_ - 1) / std::max<std::size_t>(minChunk_, 1));
+
+	if (chunks_ <= 1)
+	{
+		task_(0, 0, count_);
+		return;
+	}
+
+	std::size_t chunkSize_ = (count_ + chunks_ - 1) / chunks_;
+
+	std::mutex doneMutex_;
+	std::condition_variable doneCondition_;
+	std::size_t remaining_ = chunks_ - 1;
+
+	// The calling thread takes the first chunk, the workers the others
+	for (std::size_t i_ = 1; i_ < chunks_; i_++)
+	{
+		std::size_t begin_ = std::min(i_ * chunkSize_, count_);
+		std::size_t end_ = std::min(begin_ + chunkSize_, count_);
+
+		enqueue([&, i_, begin_, end_] () {
+			task_(i_, begin_, end_);
+
+			std::lock_guard<std::mutex> lock_(doneMutex_);
+			if (--remaining_ == 0)
+				doneCondition_.notify_one();
+		});
+	}
+
+	task_(0, 0, std::min(chunkSize_, count_));
+
+	std::unique_lock<std::mutex> lock_(doneMutex_);
+	doneCondition_.wait(lock_, [&remaining_] () { return remaining_ == 0; });
+}
+
+void ThreadPool::work ()
+{
+	while (true)
+	{
+		std::function<void()> task_;
+
+		{
+			std::unique_lock<std::mutex> lock_(mutex);
+
+			condition.wait(lock_, [this] () {
+				return stopping || !tasks.empty();
+			});
+
+			if (tasks.empty())
+				return;
+
+			task_ = std::move(tasks.front());
+			tasks.pop_front();
+		}
+
+		task_();
+	}
+}
+
+}	// namespace Zen
@@ -0,0 +1,143 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_CORE_THREADPOOL_HPP
+#define ZEN_CORE_THREADPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Zen {
+
+/**
+ * A fixed set of worker threads running queued tasks.
+ *
+ * The pool does nothing until `start` is called, so owning one costs nothing
+ * when it isn't used.
+ *
+ * @class ThreadPool
+ * @since 0.0.0
+ */
+class ThreadPool
+{
+public:
+	/**
+	 * Stops the workers, after they finish the tasks already queued.
+	 *
+	 * @since 0.0.0
+	 */
+	~ThreadPool ();
+
+	/**
+	 * Spawns the worker threads. Does nothing if the pool is already started.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param count_ The number of workers. If `0`, one less than the number of
+	 * hardware threads is used, leaving one for the main thread.
+	 */
+	void start (unsigned int count_ = 0);
+
+	/**
+	 * Finishes the queued tasks and joins every worker.
+	 *
+	 * @since 0.0.0
+	 */
+	void stop ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The number of worker threads.
+	 */
+	std::size_t size () const;
+
+	/**
+	 * Queues a task to run on one of the workers.
+	 *
+	 * If the pool has no worker, the task is run immediately on the calling
+	 * thread.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param task_ The task to run.
+	 */
+	void enqueue (std::function<void()> task_);
+
+	/**
+	 * Splits the range `[0, count_)` in contiguous chunks, one per worker plus
+	 * one for the calling thread, and runs them in parallel. Returns once
+	 * every chunk is done.
+	 *
+	 * Chunks are ordered: the chunk `i` always covers indices lower than the
+	 * chunk `i + 1`.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param count_ The number of indices to process.
+	 * @param task_ The task to run on each chunk. It receives the index of the
+	 * chunk and its `[begin, end)` range.
+	 * @param minChunk_ The minimum number of indices per chunk, to avoid waking
+	 * up the workers for tiny amounts of work.
+	 */
+	void parallelFor (
+			std::size_t count_,
+			const std::function<void(std::size_t, std::size_t, std::size_t)>& task_,
+			std::size_t minChunk_ = 1);
+
+private:
+	/**
+	 * The main loop of each worker.
+	 *
+	 * @since 0.0.0
+	 */
+	void work ();
+
+	/**
+	 * The worker threads.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::thread> workers;
+
+	/**
+	 * The tasks waiting for a worker.
+	 *
+	 * @since 0.0.0
+	 */
+	std::deque<std::function<void()>> tasks;
+
+	/**
+	 * Guards `tasks` and `stopping`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::mutex mutex;
+
+	/**
+	 * Wakes up the workers when a task is queued or the pool stops.
+	 *
+	 * @since 0.0.0
+	 */
+	std::condition_variable condition;
+
+	/**
+	 * Whether the workers must exit once the queue is empty.
+	 *
+	 * @since 0.0.0
+	 */
+	bool stopping = false;
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,45 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_ENUMS_CAPTUREFORMAT_HPP
+#define ZEN_ENUMS_CAPTUREFORMAT_HPP
+
+namespace Zen {
+
+/**
+ * The output of a frame capture.
+ *
+ * @since 0.0.0
+ */
+enum class CAPTURE_FORMAT {
+	/**
+	 * One numbered PNG file per frame.
+	 *
+	 * @since 0.0.0
+	 */
+	PNG,
+
+	/**
+	 * One numbered QOI file per frame. Much faster to encode than PNG, for a
+	 * similar size.
+	 *
+	 * @since 0.0.0
+	 */
+	QOI,
+
+	/**
+	 * A single raw YUV4MPEG2 video stream, 4:2:0 chroma subsampled. Most
+	 * video tools read it directly.
+	 *
+	 * @since 0.0.0
+	 */
+	Y4M
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_ENUMS_RENDERBACKEND_HPP
+#define ZEN_ENUMS_RENDERBACKEND_HPP
+
+namespace Zen {
+
+/**
+ * How the frames are rendered.
+ *
+ * @since 0.0.0
+ */
+enum class RENDER_BACKEND {
+	/**
+	 * The GPU renderer of the platform, presenting to a window on vsync.
+	 *
+	 * @since 0.0.0
+	 */
+	ACCELERATED,
+
+	/**
+	 * SDL's software renderer, drawing to an offscreen surface of the game
+	 * size. No display or GPU is needed, and nothing waits for vsync.
+	 *
+	 * @since 0.0.0
+	 */
+	SOFTWARE,
+
+	/**
+	 * Like `SOFTWARE`, but the draw batches are dropped instead of being
+	 * submitted and the frames are never presented. Extraction, culling and
+	 * batching still run, so the CPU cost of a frame can be measured on its
+	 * own.
+	 *
+	 * @since 0.0.0
+	 */
+	NONE
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_ENUMS_SIMDLEVEL_HPP
+#define ZEN_ENUMS_SIMDLEVEL_HPP
+
+namespace Zen {
+
+/**
+ * The instruction sets the batch math kernels can run with, from the least
+ * to the most capable.
+ *
+ * @since 0.0.0
+ */
+enum class SIMD_LEVEL {
+	SCALAR,
+	SSE2,
+	AVX2
+};
+
+}	// namespace Zen
+
+#endif
@@ -8,6 +8,7 @@
 #include "display_list.hpp"
 
 #include "../systems/depth.hpp"
+#include "../systems/dirty.hpp"
 #include "../event/event_emitter.hpp"
 #include "../utils/vector/index_of.hpp"
 
@@ -17,12 +18,20 @@ DisplayList::DisplayList ()
 {
 	unique = true;
 
-	addCallback = [this] ([[maybe_unused]] Entity gameObject) {
+	addCallback = [this] (Entity gameObject) {
+		if (spatialIndex)
+			spatialIndex->insert(gameObject);
+
 		queueDepthSort();
+		MarkFrameDirty();
 	};
 
-	removeCallback = [this] ([[maybe_unused]] Entity gameObject) {
+	removeCallback = [this] (Entity gameObject) {
+		if (spatialIndex)
+			spatialIndex->remove(gameObject);
+
 		queueDepthSort();
+		MarkFrameDirty();
 	};
 
 	sortCallback = [] (Entity childA,  Entity childB) {
@@ -40,6 +49,9 @@ void DisplayList::depthSort ()
 	if (sortChildrenFlag) {
 		std::stable_sort(list.begin(), list.end(), sortByDepth);
 
+		if (spatialIndex)
+			spatialIndex->setOrder(list);
+
 		sortChildrenFlag = false;
 	}
 }
@@ -49,7 +61,7 @@ bool DisplayList::sortByDepth (Entity childA, Entity childB)
 	return GetDepth(childA) < GetDepth(childB);
 }
 
-std::vector<Entity> DisplayList::getChildren ()
+const std::vector<Entity>& DisplayList::getChildren () const
 {
 	return list;
 }
@@ -66,4 +78,24 @@ void DisplayList::setDepth (Entity entity_, int depth_)
 	queueDepthSort();
 }
 
+void DisplayList::enableSpatialIndex (double cellSize_)
+{
+	spatialIndex = std::make_unique<SpatialIndex>(cellSize_);
+
+	for (auto& child_ : list)
+		spatialIndex->insert(child_);
+
+	spatialIndex->setOrder(list);
+}
+
+void DisplayList::disableSpatialIndex ()
+{
+	spatialIndex.reset();
+}
+
+SpatialIndex* DisplayList::getSpatialIndex ()
+{
+	return spatialIndex.get();
+}
+
 }	// namespace Zen
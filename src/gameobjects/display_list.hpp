@@ -13,6 +13,7 @@
 
 #include "../ecs/entity.hpp"
 #include "../structs/list.hpp"
+#include "spatial_index.hpp"
 
 namespace Zen {
 
@@ -78,7 +79,7 @@ public:
 	 *
 	 * @return The GameObject instances.
 	 */
-	std::vector<Entity> getChildren ();
+	const std::vector<Entity>& getChildren () const;
 
 	int getIndex (Entity child);
 
@@ -97,6 +98,45 @@ public:
 	 * @since 0.0.0
 	 */
 	void setDepth (Entity entity, int depth);
+
+	/**
+	 * Starts keeping the bounds of the Game Objects of this list in a spatial
+	 * index, so that Cameras with culling enabled only visit the Game Objects
+	 * they can see, instead of all of them.
+	 *
+	 * The order of the index is refreshed by `depthSort`. If you reorder the
+	 * list with the List methods, such as `moveTo` or `swap`, call
+	 * `queueDepthSort` as well. Game Objects added or removed with
+	 * `skipCallback` set are not seen by the index.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param cellSize The width and height of a cell of the index, in pixels.
+	 * It should be close to the size of a typical Game Object.
+	 */
+	void enableSpatialIndex (double cellSize = 256.);
+
+	/**
+	 * Stops using a spatial index.
+	 *
+	 * @since 0.0.0
+	 */
+	void disableSpatialIndex ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The spatial index of this list, or `nullptr` if it isn't enabled.
+	 */
+	SpatialIndex* getSpatialIndex ();
+
+private:
+	/**
+	 * The spatial index, if enabled.
+	 *
+	 * @since 0.0.0
+	 */
+	std::unique_ptr<SpatialIndex> spatialIndex;
 };
 
 }	// namespace Zen
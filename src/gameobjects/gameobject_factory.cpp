@@ -9,6 +9,8 @@
 #include "../scene/scene.hpp"
 
 #include <memory>
+#include <algorithm>
+#include <cstdint>
 #include "../components/alpha.hpp"
 #include "../components/blend_mode.hpp"
 #include "../components/depth.hpp"
@@ -28,14 +30,25 @@
 #include "../components/actor.hpp"
 #include "../components/crop.hpp"
 #include "../components/text.hpp"
+#include "../components/render_texture.hpp"
+#include "../components/static_layer.hpp"
 #include "../systems/size.hpp"
 #include "../systems/origin.hpp"
 #include "../systems/textured.hpp"
 #include "../systems/text.hpp"
+#include "../systems/static_layer.hpp"
+#include "../cameras/2d/systems/camera.hpp"
+#include "../texture/texture_manager.hpp"
+#include "../renderer/renderer.hpp"
+#include "../window/window.hpp"
+#include "../utils/messages.hpp"
 
 namespace Zen {
 
 extern entt::registry g_registry;
+extern Window g_window;
+extern Renderer g_renderer;
+extern TextureManager g_texture;
 
 
 GameObjectFactory::GameObjectFactory (Scene* scene_)
@@ -86,6 +99,102 @@ Entity GameObjectFactory::image (double x, double y, std::string key, std::strin
 	return img;
 }
 
+Entity GameObjectFactory::renderTexture (double x, double y, int width, int height)
+{
+	width = std::max(1, width);
+	height = std::max(1, height);
+
+	SDL_Texture *texture = nullptr;
+
+	g_renderer.invoke([&] () {
+		texture = SDL_CreateTexture(
+				g_window.renderer,
+				SDL_PIXELFORMAT_RGBA8888,
+				SDL_TEXTUREACCESS_TARGET,
+				width,
+				height
+				);
+	});
+
+	if (!texture)
+	{
+		MessageError("Unable to create the render texture: ", SDL_GetError());
+
+		return entt::null;
+	}
+
+	g_renderer.setTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+	// Start fully transparent
+	g_renderer.flush();
+	g_renderer.setRenderTarget(texture);
+	g_renderer.setDrawColor(0x00, 0x00, 0x00, 0x00);
+	g_renderer.commandBuffer.clear();
+	g_renderer.setRenderTarget(nullptr);
+
+	auto rt = g_registry.create();
+
+	g_registry.emplace<Components::RenderTexture>(rt, texture, width, height, "");
+
+	std::string key = "__RENDER_TEXTURE_" + std::to_string(static_cast<std::uint32_t>(rt));
+
+	if (g_texture.addRenderTexture(key, rt) == entt::null)
+	{
+		g_renderer.destroyTexture(texture);
+		g_registry.destroy(rt);
+
+		return entt::null;
+	}
+
+	g_registry.emplace<Components::Alpha>(rt);
+	g_registry.emplace<Components::BlendMode>(rt);
+	g_registry.emplace<Components::Depth>(rt);
+	g_registry.emplace<Components::Flip>(rt);
+	g_registry.emplace<Components::Bounds>(rt);
+	g_registry.emplace<Components::Mask>(rt);
+	g_registry.emplace<Components::Origin>(rt);
+	g_registry.emplace<Components::ScrollFactor>(rt);
+	g_registry.emplace<Components::Size>(rt);
+	g_registry.emplace<Components::Textured>(rt);
+	g_registry.emplace<Components::Tint>(rt);
+	g_registry.emplace<Components::Position>(rt, x, y);
+	g_registry.emplace<Components::Rotation>(rt);
+	g_registry.emplace<Components::Scale>(rt);
+	g_registry.emplace<Components::Visible>(rt);
+	g_registry.emplace<Components::Renderable>(rt);
+	g_registry.emplace<Components::Crop>(rt);
+	g_registry.emplace<Components::Actor>(rt);
+
+	SetTexture(rt, key, "__BASE");
+	SetSizeToFrame(rt);
+	SetOrigin(rt, 0.);
+
+	scene->children.add(rt);
+
+	return rt;
+}
+
+Entity GameObjectFactory::staticLayer (double x, double y, int width, int height,
+		std::vector<Entity> members)
+{
+	auto layer = renderTexture(x, y, width, height);
+
+	if (layer == entt::null)
+		return layer;
+
+	auto& rt = g_registry.get<Components::RenderTexture>(layer);
+
+	// Not part of the Camera Manager, it only renders the members
+	auto camera = CreateCamera(0, 0, rt.width, rt.height);
+
+	g_registry.emplace<Components::StaticLayer>(layer, camera, std::vector<Entity>{}, true);
+
+	for (auto member : members)
+		AddToLayer(layer, member);
+
+	return layer;
+}
+
 Entity GameObjectFactory::text (double x, double y, std::string text, TextStyle style)
 {
 	auto txt = g_registry.create();
@@ -9,6 +9,7 @@
 #define ZEN_GAMEOBJECTS_GAMEOBJECTFACTORY_H
 
 #include <string>
+#include <vector>
 #include "../scene/scene.fwd.hpp"
 #include "../ecs/entity.hpp"
 #include "../text/text_style.hpp"
@@ -45,6 +46,46 @@ public:
 	 */
 	Entity image (double x, double y, std::string key, std::string frame = "");
 
+	/**
+	 * Creates a texture Game Objects can be rendered to, drawn like an Image.
+	 *
+	 * Its texture is added to the Texture Manager with the key
+	 * `__RENDER_TEXTURE_<entity>`, so that other Game Objects can use it too.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param x The position of the top-left corner on the x axis.
+	 * @param y The position of the top-left corner on the y axis.
+	 * @param width The width of the texture, in pixels.
+	 * @param height The height of the texture, in pixels.
+	 */
+	Entity renderTexture (double x, double y, int width, int height);
+
+	/**
+	 * Creates a Render Texture drawing a group of Game Objects that rarely
+	 * change. They are rendered once into its texture, which is then drawn as
+	 * a single quad every frame, until one of them changes.
+	 *
+	 * The members are positioned relative to the top-left corner of the
+	 * layer, and the layer can be moved around without rendering them again.
+	 *
+	 * ```cpp
+	 * auto layer = add.staticLayer(0, 0, 800, 600);
+	 *
+	 * for (auto& tile : tiles)
+	 *		AddToLayer(layer, add.image(tile.x, tile.y, "tiles", tile.frame));
+	 * ```
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param x The position of the top-left corner on the x axis.
+	 * @param y The position of the top-left corner on the y axis.
+	 * @param width The width of the layer, in pixels.
+	 * @param height The height of the layer, in pixels.
+	 * @param members The Game Objects to add to the layer.
+	 */
+	Entity staticLayer (double x, double y, int width, int height, std::vector<Entity> members = {});
+
 	/**
 	 * ```cpp
 	 * auto text = this.add.text(100, 150, "Score: 0", {
@@ -0,0 +1,368 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "spatial_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../components/position.hpp"
+#include "../components/size.hpp"
+#include "../components/origin.hpp"
+#include "../components/scale.hpp"
+#include "../components/scroll_factor.hpp"
+#include "../components/container_item.hpp"
+#include "../components/text.hpp"
+#include "../components/update.hpp"
+#include "../components/spatial_item.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+/**
+ * Game Objects covering more cells than this are kept in the unbounded list,
+ * and tested against the area of every query instead.
+ */
+static const int MAX_CELLS = 1024;
+
+/**
+ * The largest cell coordinate, so that cell coordinates fit in an `int`.
+ */
+static const double MAX_COORDINATE = 1e9;
+
+template <typename Component>
+static void AddUpdate (Entity entity_)
+{
+	if (!g_registry.has<Components::Update<Component>>(entity_))
+		g_registry.emplace<Components::Update<Component>>(entity_, &UpdateSpatialIndex);
+}
+
+template <typename Component>
+static void RemoveUpdate (Entity entity_)
+{
+	auto update_ = g_registry.try_get<Components::Update<Component>>(entity_);
+
+	if (update_ && update_->update == &UpdateSpatialIndex)
+		g_registry.remove<Components::Update<Component>>(entity_);
+}
+
+SpatialIndex::SpatialIndex (double cellSize_)
+	: cellSize (cellSize_ > 0. ? cellSize_ : 256.)
+{}
+
+SpatialIndex::~SpatialIndex ()
+{
+	clear();
+}
+
+void SpatialIndex::insert (Entity entity_)
+{
+	if (items.count(entity_))
+		return;
+
+	g_registry.emplace_or_replace<Components::SpatialItem>(entity_, this);
+
+	AddUpdate<Components::Position>(entity_);
+	AddUpdate<Components::Size>(entity_);
+	AddUpdate<Components::Origin>(entity_);
+	AddUpdate<Components::ScrollFactor>(entity_);
+	AddUpdate<Components::Scale>(entity_);
+
+	Item item_;
+	item_.order = items.size();
+	computeBounds(entity_, &item_);
+
+	link(entity_, item_);
+	items.emplace(entity_, item_);
+}
+
+void SpatialIndex::remove (Entity entity_)
+{
+	auto it_ = items.find(entity_);
+
+	if (it_ == items.end())
+		return;
+
+	unlink(entity_, it_->second);
+	items.erase(it_);
+
+	if (!g_registry.valid(entity_))
+		return;
+
+	auto spatialItem_ = g_registry.try_get<Components::SpatialItem>(entity_);
+	if (spatialItem_ && spatialItem_->index == this)
+		g_registry.remove<Components::SpatialItem>(entity_);
+
+	RemoveUpdate<Components::Position>(entity_);
+	RemoveUpdate<Components::Size>(entity_);
+	RemoveUpdate<Components::Origin>(entity_);
+	RemoveUpdate<Components::ScrollFactor>(entity_);
+	RemoveUpdate<Components::Scale>(entity_);
+}
+
+void SpatialIndex::clear ()
+{
+	while (!items.empty())
+		remove(items.begin()->first);
+
+	cells.clear();
+	unbounded.clear();
+}
+
+void SpatialIndex::update (Entity entity_)
+{
+	auto it_ = items.find(entity_);
+
+	if (it_ == items.end())
+		return;
+
+	Item& item_ = it_->second;
+	Item next_ = item_;
+
+	computeBounds(entity_, &next_);
+
+	// Only the bounds changed, the Game Object stays in the same cells
+	if (item_.unbounded == next_.unbounded &&
+		item_.cellLeft == next_.cellLeft && item_.cellTop == next_.cellTop &&
+		item_.cellRight == next_.cellRight && item_.cellBottom == next_.cellBottom)
+	{
+		item_ = next_;
+		return;
+	}
+
+	unlink(entity_, item_);
+	item_ = next_;
+	link(entity_, item_);
+}
+
+void SpatialIndex::setOrder (const std::vector<Entity>& list_)
+{
+	for (std::size_t i_ = 0; i_ < list_.size(); i_++)
+	{
+		auto it_ = items.find(list_[i_]);
+
+		if (it_ != items.end())
+			it_->second.order = i_;
+	}
+}
+
+void SpatialIndex::query (const Rectangle& area_, std::vector<Entity> *output_)
+{
+	output_->clear();
+
+	// A new stamp for this query, resetting the items when it wraps around
+	if (++stamp == 0)
+	{
+		for (auto& it_ : items)
+			it_.second.stamp = 0;
+
+		stamp = 1;
+	}
+
+	double right_ = area_.x + area_.width;
+	double bottom_ = area_.y + area_.height;
+
+	auto visit_ = [&] (Entity entity_) {
+		Item& item_ = items[entity_];
+
+		if (item_.stamp == stamp)
+			return;
+
+		item_.stamp = stamp;
+
+		if (item_.right >= area_.x && item_.left <= right_ &&
+			item_.bottom >= area_.y && item_.top <= bottom_)
+			output_->emplace_back(entity_);
+	};
+
+	for (auto entity_ : unbounded)
+		visit_(entity_);
+
+	double cellLeft_ = std::floor(area_.x / cellSize);
+	double cellTop_ = std::floor(area_.y / cellSize);
+	double cellRight_ = std::floor(right_ / cellSize);
+	double cellBottom_ = std::floor(bottom_ / cellSize);
+
+	double cellCount_ = (cellRight_ - cellLeft_ + 1.) * (cellBottom_ - cellTop_ + 1.);
+
+	// Looking up every cell would cost more than testing every item
+	if (!(cellCount_ <= static_cast<double>(items.size())) ||
+		std::max(std::abs(cellLeft_), std::abs(cellRight_)) > MAX_COORDINATE ||
+		std::max(std::abs(cellTop_), std::abs(cellBottom_)) > MAX_COORDINATE)
+	{
+		for (auto& it_ : items)
+			visit_(it_.first);
+	}
+	else
+	{
+		for (int y_ = static_cast<int>(cellTop_); y_ <= static_cast<int>(cellBottom_); y_++)
+		{
+			for (int x_ = static_cast<int>(cellLeft_); x_ <= static_cast<int>(cellRight_); x_++)
+			{
+				auto cell_ = cells.find(key(x_, y_));
+
+				if (cell_ == cells.end())
+					continue;
+
+				for (auto entity_ : cell_->second)
+					visit_(entity_);
+			}
+		}
+	}
+
+	std::sort(output_->begin(), output_->end(), [this] (Entity a_, Entity b_) {
+		return items[a_].order < items[b_].order;
+	});
+}
+
+std::size_t SpatialIndex::size () const
+{
+	return items.size();
+}
+
+double SpatialIndex::getCellSize () const
+{
+	return cellSize;
+}
+
+bool SpatialIndex::computeBounds (Entity entity_, Item *item_) const
+{
+	auto [position_, size_, origin_, scale_, scrollFactor_, containerItem_] = g_registry.try_get<
+		Components::Position,
+		Components::Size,
+		Components::Origin,
+		Components::Scale,
+		Components::ScrollFactor,
+		Components::ContainerItem
+		>(entity_);
+
+	bool placeable_ = position_ && size_ &&
+		std::isfinite(position_->x) && std::isfinite(position_->y) &&
+		!(scrollFactor_ && (scrollFactor_->x != 1. || scrollFactor_->y != 1.)) &&
+		!(containerItem_ && containerItem_->parent != entt::null) &&
+		!g_registry.has<Components::Text>(entity_);
+
+	if (!placeable_)
+	{
+		double infinity_ = std::numeric_limits<double>::infinity();
+
+		item_->left = item_->top = -infinity_;
+		item_->right = item_->bottom = infinity_;
+		item_->unbounded = true;
+
+		return false;
+	}
+
+	double width_ = size_->width * (scale_ ? std::abs(scale_->x) : 1.);
+	double height_ = size_->height * (scale_ ? std::abs(scale_->y) : 1.);
+
+	// The farthest corner from the origin, where the Game Object rotates
+	double originX_ = (origin_ ? origin_->x : 0.) * width_;
+	double originY_ = (origin_ ? origin_->y : 0.) * height_;
+	double radius_ = std::hypot(
+			std::max(std::abs(originX_), std::abs(width_ - originX_)),
+			std::max(std::abs(originY_), std::abs(height_ - originY_)));
+
+	item_->left = position_->x - radius_;
+	item_->top = position_->y - radius_;
+	item_->right = position_->x + radius_;
+	item_->bottom = position_->y + radius_;
+
+	// Too far away to be given cell coordinates
+	if (!std::isfinite(radius_) ||
+		std::max(std::abs(item_->left), std::abs(item_->right)) / cellSize > MAX_COORDINATE ||
+		std::max(std::abs(item_->top), std::abs(item_->bottom)) / cellSize > MAX_COORDINATE)
+	{
+		if (!std::isfinite(radius_))
+		{
+			double infinity_ = std::numeric_limits<double>::infinity();
+
+			item_->left = item_->top = -infinity_;
+			item_->right = item_->bottom = infinity_;
+		}
+
+		item_->unbounded = true;
+
+		return true;
+	}
+
+	item_->cellLeft = static_cast<int>(std::floor(item_->left / cellSize));
+	item_->cellTop = static_cast<int>(std::floor(item_->top / cellSize));
+	item_->cellRight = static_cast<int>(std::floor(item_->right / cellSize));
+	item_->cellBottom = static_cast<int>(std::floor(item_->bottom / cellSize));
+
+	item_->unbounded = (item_->cellRight - item_->cellLeft + 1) *
+		(item_->cellBottom - item_->cellTop + 1) > MAX_CELLS;
+
+	return true;
+}
+
+void SpatialIndex::link (Entity entity_, const Item& item_)
+{
+	if (item_.unbounded)
+	{
+		unbounded.emplace_back(entity_);
+		return;
+	}
+
+	for (int y_ = item_.cellTop; y_ <= item_.cellBottom; y_++)
+		for (int x_ = item_.cellLeft; x_ <= item_.cellRight; x_++)
+			cells[key(x_, y_)].emplace_back(entity_);
+}
+
+void SpatialIndex::unlink (Entity entity_, const Item& item_)
+{
+	auto erase_ = [entity_] (std::vector<Entity>& list_) {
+		auto it_ = std::find(list_.begin(), list_.end(), entity_);
+
+		if (it_ != list_.end())
+		{
+			*it_ = list_.back();
+			list_.pop_back();
+		}
+	};
+
+	if (item_.unbounded)
+	{
+		erase_(unbounded);
+		return;
+	}
+
+	for (int y_ = item_.cellTop; y_ <= item_.cellBottom; y_++)
+	{
+		for (int x_ = item_.cellLeft; x_ <= item_.cellRight; x_++)
+		{
+			auto cell_ = cells.find(key(x_, y_));
+
+			if (cell_ == cells.end())
+				continue;
+
+			erase_(cell_->second);
+
+			if (cell_->second.empty())
+				cells.erase(cell_);
+		}
+	}
+}
+
+std::uint64_t SpatialIndex::key (int x_, int y_)
+{
+	return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x_)) << 32) |
+		static_cast<std::uint32_t>(y_);
+}
+
+void UpdateSpatialIndex (Entity entity)
+{
+	auto spatialItem = g_registry.try_get<Components::SpatialItem>(entity);
+
+	if (spatialItem && spatialItem->index)
+		spatialItem->index->update(entity);
+}
+
+}	// namespace Zen
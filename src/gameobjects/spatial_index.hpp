@@ -0,0 +1,243 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_GAMEOBJECTS_SPATIALINDEX_HPP
+#define ZEN_GAMEOBJECTS_SPATIALINDEX_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "../ecs/entity.hpp"
+#include "../geom/types/rectangle.hpp"
+
+namespace Zen {
+
+/**
+ * A uniform grid of the world bounds of Game Objects, used to find the ones
+ * overlapping an area without testing all of them.
+ *
+ * The bounds of a Game Object are the square around its position that
+ * contains it whatever its rotation, so that rotating it never moves it in the
+ * grid. They are updated by `UpdateSpatialIndex`, which the `Position`,
+ * `Size`, `Origin`, `ScrollFactor` and `Scale` setters call through their
+ * `Update` components.
+ *
+ * Game Objects that can't be placed in the world are kept aside and returned
+ * by every query: those with a scroll factor other than 1, those inside a
+ * Container, Text objects and those missing a transform component.
+ *
+ * @class SpatialIndex
+ * @since 0.0.0
+ */
+class SpatialIndex
+{
+public:
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param cellSize_ The width and height of a cell of the grid, in pixels.
+	 */
+	SpatialIndex (double cellSize_ = 256.);
+
+	/**
+	 * Removes every Game Object from the index.
+	 *
+	 * @since 0.0.0
+	 */
+	~SpatialIndex ();
+
+	/**
+	 * Adds a Game Object to the index and starts tracking its transform.
+	 *
+	 * Its `Update<Position>`, `Update<Size>`, `Update<Origin>`,
+	 * `Update<ScrollFactor>` and `Update<Scale>` components are added, unless
+	 * it already has them.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity_ The Game Object to add.
+	 */
+	void insert (Entity entity_);
+
+	/**
+	 * Removes a Game Object from the index, along with the `Update`
+	 * components `insert` added.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity_ The Game Object to remove.
+	 */
+	void remove (Entity entity_);
+
+	/**
+	 * Removes every Game Object from the index.
+	 *
+	 * @since 0.0.0
+	 */
+	void clear ();
+
+	/**
+	 * Recomputes the bounds of a Game Object, and moves it to the cells they
+	 * now overlap.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity_ The Game Object to update.
+	 */
+	void update (Entity entity_);
+
+	/**
+	 * Stores the position of each Game Object in the display list, used to
+	 * sort the results of `query`.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param list_ The Game Objects in display order.
+	 */
+	void setOrder (const std::vector<Entity>& list_);
+
+	/**
+	 * Finds the Game Objects whose bounds overlap an area, in display order.
+	 *
+	 * The cost is proportional to the number of cells the area covers and the
+	 * number of Game Objects found, not to the size of the index.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param area_ The area to search, in world coordinates.
+	 * @param output_ The vector to fill. It is cleared first.
+	 */
+	void query (const Rectangle& area_, std::vector<Entity> *output_);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The number of Game Objects in the index.
+	 */
+	std::size_t size () const;
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The width and height of a cell, in pixels.
+	 */
+	double getCellSize () const;
+
+private:
+	/**
+	 * What the index knows about each Game Object.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Item
+	{
+		/**
+		 * The world bounds.
+		 */
+		double left = 0., top = 0., right = 0., bottom = 0.;
+
+		/**
+		 * The range of cells covered, inclusive.
+		 */
+		int cellLeft = 0, cellTop = 0, cellRight = -1, cellBottom = -1;
+
+		/**
+		 * Whether the Game Object is returned by every query instead of being
+		 * placed in the grid.
+		 */
+		bool unbounded = false;
+
+		/**
+		 * The position in the display list.
+		 */
+		std::size_t order = 0;
+
+		/**
+		 * The last query that returned this item, so that Game Objects
+		 * covering many cells are returned once.
+		 */
+		std::uint32_t stamp = 0;
+	};
+
+	/**
+	 * Computes the bounds of a Game Object.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return `false` if the Game Object can't be placed in the world.
+	 */
+	bool computeBounds (Entity entity_, Item *item_) const;
+
+	/**
+	 * Adds or removes a Game Object from the cells or the unbounded list.
+	 *
+	 * @since 0.0.0
+	 */
+	void link (Entity entity_, const Item& item_);
+
+	void unlink (Entity entity_, const Item& item_);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The key of the cell at the given grid coordinates.
+	 */
+	static std::uint64_t key (int x_, int y_);
+
+	/**
+	 * The width and height of a cell, in pixels.
+	 *
+	 * @since 0.0.0
+	 */
+	double cellSize;
+
+	/**
+	 * The Game Objects of each non empty cell.
+	 *
+	 * @since 0.0.0
+	 */
+	std::unordered_map<std::uint64_t, std::vector<Entity>> cells;
+
+	/**
+	 * The Game Objects returned by every query.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entity> unbounded;
+
+	/**
+	 * Every Game Object in the index.
+	 *
+	 * @since 0.0.0
+	 */
+	std::unordered_map<Entity, Item> items;
+
+	/**
+	 * The stamp of the current query.
+	 *
+	 * @since 0.0.0
+	 */
+	std::uint32_t stamp = 0;
+};
+
+/**
+ * Updates the bounds of a Game Object in the spatial index it belongs to.
+ *
+ * This is the callback of the `Update` components added by
+ * `SpatialIndex::insert`.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Game Object that changed.
+ */
+void UpdateSpatialIndex (Entity entity);
+
+}	// namespace Zen
+
+#endif
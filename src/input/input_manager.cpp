@@ -15,6 +15,7 @@
 #include "../scene/scene.hpp"
 #include "../scale/scale_manager.hpp"
 #include "../window/window.hpp"
+#include "../renderer/renderer.hpp"
 #include "../core/config.hpp"
 #include "../components/container_item.hpp"
 #include "../components/scroll.hpp"
@@ -36,6 +37,7 @@ extern entt::registry g_registry;
 extern SceneManager g_scene;
 extern ScaleManager g_scale;
 extern Window g_window;
+extern Renderer g_renderer;
 
 InputManager::InputManager ()
 {}
@@ -112,11 +114,34 @@ void InputManager::createColorCursor (std::string key_, std::string path_, int h
 		return;
 	}
 
-	cursors[key_] = SDL_CreateColorCursor(cursorImage_, hotX_, hotY_);
+	createColorCursor(key_, cursorImage_, hotX_, hotY_);
 	SDL_FreeSurface(cursorImage_);
-	if (cursors[key_] == nullptr)
+}
+
+void InputManager::createColorCursor (std::string key_, SDL_Surface *image_, int hotX_, int hotY_)
+{
+	if (cursors.find(key_) != cursors.end())
 	{
-		MessageError("The cursor couldn't be created: ", path_);
+		MessageError("There is already a cursor with the requested key: ", key_);
+		return;
+	}
+
+	if (image_ == nullptr)
+	{
+		MessageError("No image to create the cursor with: ", key_);
+		return;
+	}
+
+	SDL_Cursor *cursor_ = nullptr;
+
+	g_renderer.invoke([&] () {
+		cursor_ = SDL_CreateColorCursor(image_, hotX_, hotY_);
+	});
+
+	cursors[key_] = cursor_;
+	if (cursor_ == nullptr)
+	{
+		MessageError("The cursor couldn't be created: ", key_);
 	}
 }
 
@@ -115,6 +115,21 @@ public:
 	 */
 	void createColorCursor (std::string key, std::string path, int hotX, int hotY);
 
+	/**
+	 * Creates a new cursor from an image already decoded. The cursor is
+	 * created on the main thread.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param key The key to store the cursor with.
+	 * @param image The image of the cursor. It is not freed.
+	 * @param hotX The X-axis location of the upper left corner of the cursor
+	 * relative to the actual mouse position.
+	 * @param hotY The Y-axis location of the upper left corner of the cursor
+	 * relative to the actual mouse position.
+	 */
+	void createColorCursor (std::string key, SDL_Surface *image, int hotX, int hotY);
+
 	void createSystemCursor (std::string key, SDL_SystemCursor cursor);
 
 	/**
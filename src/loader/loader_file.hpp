@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_LOADER_LOADER_FILE_HPP
+#define ZEN_LOADER_LOADER_FILE_HPP
+
+#include <functional>
+#include <string>
+
+namespace Zen {
+
+/**
+ * A file in the queue of a LoaderPlugin.
+ *
+ * Loading it is split in two steps sharing their data: `decode` reads and
+ * decodes the file on a worker thread, then `upload` creates the resources
+ * from it on the thread of the Scene.
+ *
+ * @since 0.0.0
+ */
+struct LoaderFile
+{
+	/**
+	 * The key the file is added with.
+	 *
+	 * @since 0.0.0
+	 */
+	std::string key;
+
+	/**
+	 * Reads and decodes the file. Must not touch the renderer or OpenAL.
+	 *
+	 * @since 0.0.0
+	 */
+	std::function<void()> decode;
+
+	/**
+	 * Creates the textures, buffers or fonts of the file.
+	 *
+	 * @since 0.0.0
+	 */
+	std::function<void()> upload;
+};
+
+}	// namespace Zen
+
+#endif
@@ -8,12 +8,16 @@
 #include "loader_plugin.hpp"
 
 #include <fstream>
+#include <SDL2/SDL_timer.h>
 #include "json/json.hpp"
 
 #include "../utils/messages.hpp"
 #include "../event/event_emitter.hpp"
 
 #include "../texture/texture_manager.hpp"
+#include "../texture/systems/source.hpp"
+#include "../texture/systems/alpha_mask.hpp"
+#include "../texture/parsers/atlas_binary.hpp"
 #include "../scene/scene.hpp"
 #include "../scene/scene_manager.hpp"
 #include "../cameras/2d/camera_manager.hpp"
@@ -21,6 +25,8 @@
 #include "../audio/audio_manager.hpp"
 #include "../input/input_manager.hpp"
 #include "../text/text_manager.hpp"
+#include "../audio/tools/ogg.hpp"
+#include "../core/thread_pool.hpp"
 
 namespace Zen {
 
@@ -54,14 +60,179 @@ LoaderPlugin& LoaderPlugin::setPrefix (std::string prefix_)
 	return *this;
 }
 
+/**
+ * The workers decoding the files of every LoaderPlugin.
+ */
+static ThreadPool& LoaderWorkers ()
+{
+	static ThreadPool workers_;
+
+	workers_.start();
+
+	return workers_;
+}
+
+/**
+ * Images decoded by a worker, handed to the Texture Manager on upload. The
+ * ones never uploaded are freed with it.
+ */
+struct DecodedImages
+{
+	DecodedImages () = default;
+
+	DecodedImages (const DecodedImages&) = delete;
+
+	DecodedImages& operator = (const DecodedImages&) = delete;
+
+	~DecodedImages ()
+	{
+		for (auto surface_ : surfaces)
+			if (surface_)
+				SDL_FreeSurface(surface_);
+	}
+
+	void decode ()
+	{
+		surfaces.resize(paths.size(), nullptr);
+
+		for (std::size_t i_ = 0; i_ < paths.size(); i_++)
+			surfaces[i_] = DecodeTextureSource(paths[i_]);
+
+		// The opaque pixels, for the renderer to skip what they cover
+		if (g_config->overdrawCulling)
+		{
+			for (auto surface_ : surfaces)
+				opacities.emplace_back(CreateAlphaMask(surface_, 1, 0xff));
+		}
+
+		if (!alphaMasks)
+			return;
+
+		for (auto surface_ : surfaces)
+			masks.emplace_back(CreateAlphaMask(surface_, g_config->alphaMaskDepth,
+						static_cast<Uint8>(g_config->alphaMaskThreshold)));
+	}
+
+	/**
+	 * Hands the images to the next textures created from their paths.
+	 */
+	void stage ()
+	{
+		for (std::size_t i_ = 0; i_ < surfaces.size(); i_++)
+		{
+			StageTextureSource(paths[i_], surfaces[i_],
+					i_ < opacities.size() ? std::move(opacities[i_]) : Components::AlphaMask {});
+			surfaces[i_] = nullptr;
+		}
+	}
+
+	std::vector<std::string> paths;
+
+	std::vector<SDL_Surface*> surfaces;
+
+	std::vector<Components::AlphaMask> opacities;
+
+	/**
+	 * Whether to build the alpha masks of the images, while they are decoded.
+	 */
+	bool alphaMasks = false;
+
+	std::vector<Components::AlphaMask> masks;
+};
+
+/**
+ * The frame data of an atlas, read by a worker: either its binary copy
+ * mapped in memory, or its parsed JSON.
+ */
+struct DecodedAtlas
+{
+	void decode ()
+	{
+		if (g_config->atlasCache && OpenAtlasBinary(dataPath, binary))
+		{
+			hasBinary = true;
+			return;
+		}
+
+		std::ifstream file_ (dataPath);
+
+		if (!file_)
+		{
+			MessageError("JSON file couldn't be opened: ", dataPath);
+			return;
+		}
+
+		try
+		{
+			file_ >> data;
+			hasData = true;
+		}
+		catch (const nlohmann::json::exception& error_)
+		{
+			MessageError("Invalid Texture Atlas JSON ", dataPath, ": ", error_.what());
+		}
+	}
+
+	/**
+	 * @return The file names of the images of a multi-atlas.
+	 */
+	std::vector<std::string> images ()
+	{
+		std::vector<std::string> images_;
+
+		if (hasBinary)
+		{
+			for (std::size_t i_ = 0; i_ < binary.sourceCount(); i_++)
+			{
+				const auto& source_ = binary.source(i_);
+
+				images_.emplace_back(binary.string(source_.image, source_.imageLength));
+			}
+		}
+		else if (hasData && data.contains("textures"))
+		{
+			for (const auto& textureFile_ : data["textures"])
+				images_.emplace_back(textureFile_.value("image", ""));
+		}
+
+		return images_;
+	}
+
+	std::string dataPath;
+
+	AtlasBinary binary;
+
+	bool hasBinary = false;
+
+	nlohmann::json data;
+
+	bool hasData = false;
+};
+
 LoaderPlugin& LoaderPlugin::image (std::string key_, std::string path_, bool alphaCache_)
 {
 	path_ = path + path_;
 
-	g_texture.addImage(key_, path_);
+	auto images_ = std::make_shared<DecodedImages>();
+	images_->paths.emplace_back(path_);
+	images_->alphaMasks = alphaCache_;
 
-	if (alphaCache_)
-		g_texture.createAlphaCache(key_);
+	add(std::make_shared<LoaderFile>(LoaderFile {
+		key_,
+		[images_] () {
+			images_->decode();
+		},
+		[images_, key_, path_, alphaCache_] () {
+			images_->stage();
+
+			g_texture.addImage(key_, path_);
+
+			ClearStagedTextureSources();
+
+			if (alphaCache_)
+				g_texture.createAlphaCache(key_, std::move(images_->masks));
+		}
+	}));
 
 	return *this;
 }
@@ -70,7 +241,24 @@ LoaderPlugin& LoaderPlugin::cursor (std::string key_, std::string path_, int hot
 {
 	path_ = path + path_;
 
-	g_input.createColorCursor(key_, path_, hotX_, hotY_);
+	auto images_ = std::make_shared<DecodedImages>();
+	images_->paths.emplace_back(path_);
+
+	add(std::make_shared<LoaderFile>(LoaderFile {
+		key_,
+		[images_] () {
+			images_->decode();
+		},
+		[images_, key_, path_, hotX_, hotY_] () {
+			if (images_->surfaces.empty() || !images_->surfaces[0])
+			{
+				MessageError("The image couldn't be loaded for cursor creation: ", path_);
+				return;
+			}
+
+			g_input.createColorCursor(key_, images_->surfaces[0], hotX_, hotY_);
+		}
+	}));
 
 	return *this;
 }
@@ -80,7 +268,29 @@ LoaderPlugin& LoaderPlugin::atlas (std::string key_, std::string texturePath_, s
 	texturePath_ = path + texturePath_;
 	atlasPath_ = path + atlasPath_;
 
-	g_texture.addAtlas(key_, texturePath_, atlasPath_);
+	auto images_ = std::make_shared<DecodedImages>();
+	images_->paths.emplace_back(texturePath_);
+
+	auto atlas_ = std::make_shared<DecodedAtlas>();
+	atlas_->dataPath = atlasPath_;
+
+	add(std::make_shared<LoaderFile>(LoaderFile {
+		key_,
+		[images_, atlas_] () {
+			atlas_->decode();
+			images_->decode();
+		},
+		[images_, atlas_, key_] () {
+			images_->stage();
+
+			if (atlas_->hasBinary)
+				g_texture.addAtlasBinary(key_, images_->paths, atlas_->binary);
+			else if (atlas_->hasData)
+				g_texture.addAtlasJSON(key_, images_->paths, atlas_->data);
+
+			ClearStagedTextureSources();
+		}
+	}));
 
 	return *this;
 }
@@ -90,27 +300,33 @@ LoaderPlugin& LoaderPlugin::multiatlas (std::string key_, std::string atlasPath_
 	atlasPath_ = path + atlasPath_;
 	path_ = path + path_;
 
-	std::vector<std::string> sources_;
+	auto images_ = std::make_shared<DecodedImages>();
 
-	// Open data file
-	std::ifstream file_ (atlasPath_);
+	auto atlas_ = std::make_shared<DecodedAtlas>();
+	atlas_->dataPath = atlasPath_;
 
-	if (!file_.is_open()) {
-		MessageError("Atlas file failed to open: ", atlasPath_);
-		return *this;
-	}
+	add(std::make_shared<LoaderFile>(LoaderFile {
+		key_,
+		[images_, atlas_, path_] () {
+			// The image names are in the atlas data, parsed only once
+			atlas_->decode();
 
-	// Create a JSON object
-	nlohmann::json data_;
-	file_ >> data_;
+			for (const auto& image_ : atlas_->images())
+				images_->paths.emplace_back(path_ + image_);
 
-	// Close file
-	file_.close();
+			images_->decode();
+		},
+		[images_, atlas_, key_] () {
+			images_->stage();
 
-	for (const auto& textureFile_ : data_["textures"])
-		sources_.emplace_back(path_ + textureFile_["image"].get<std::string>());
+			if (atlas_->hasBinary)
+				g_texture.addAtlasBinary(key_, images_->paths, atlas_->binary);
+			else if (atlas_->hasData)
+				g_texture.addAtlasJSONArray(key_, images_->paths, atlas_->data);
 
-	g_texture.addAtlas(key_, sources_, atlasPath_);
+			ClearStagedTextureSources();
+		}
+	}));
 
 	return *this;
 }
@@ -119,7 +335,22 @@ LoaderPlugin& LoaderPlugin::spritesheet (std::string key_, std::string path_, Sp
 {
 	path_ = path + path_;
 
-	g_texture.addSpriteSheet(key_, path_, config_);
+	auto images_ = std::make_shared<DecodedImages>();
+	images_->paths.emplace_back(path_);
+
+	add(std::make_shared<LoaderFile>(LoaderFile {
+		key_,
+		[images_] () {
+			images_->decode();
+		},
+		[images_, key_, path_, config_] () {
+			images_->stage();
+
+			g_texture.addSpriteSheet(key_, path_, config_);
+
+			ClearStagedTextureSources();
+		}
+	}));
 
 	return *this;
 }
@@ -128,7 +359,19 @@ LoaderPlugin& LoaderPlugin::audioShort (std::string key_, std::string path_)
 {
 	path_ = path + path_;
 
-	g_audio.addAudioShort(key_, path_);
+	auto audio_ = std::make_shared<AudioData>();
+	auto decoded_ = std::make_shared<bool>(false);
+
+	add(std::make_shared<LoaderFile>(LoaderFile {
+		key_,
+		[audio_, decoded_, path_] () {
+			*decoded_ = decode_ogg(path_, audio_.get()) == 0;
+		},
+		[audio_, decoded_, key_] () {
+			if (*decoded_)
+				g_audio.addAudioShort(key_, *audio_);
+		}
+	}));
 
 	return *this;
 }
@@ -137,7 +380,14 @@ LoaderPlugin& LoaderPlugin::audioStream (std::string key_, std::string path_)
 {
 	path_ = path + path_;
 
-	g_audio.addAudioStream(key_, path_);
+	// Only opened to check it exists, there is nothing to decode ahead
+	add(std::make_shared<LoaderFile>(LoaderFile {
+		key_,
+		[] () {},
+		[key_, path_] () {
+			g_audio.addAudioStream(key_, path_);
+		}
+	}));
 
 	return *this;
 }
@@ -146,7 +396,15 @@ LoaderPlugin& LoaderPlugin::font (std::string key_, std::string path_)
 {
 	path_ = path + path_;
 
-	g_text.addFont(key_, path_);
+	// FreeType faces share the library of the Text Manager, they are opened
+	// on its thread
+	add(std::make_shared<LoaderFile>(LoaderFile {
+		key_,
+		[] () {},
+		[key_, path_] () {
+			g_text.addFont(key_, path_);
+		}
+	}));
 
 	return *this;
 }
@@ -155,6 +413,140 @@ void LoaderPlugin::reset ()
 {
 	setPath(g_config->loaderPath);
 	setPrefix(g_config->loaderPrefix);
+
+	// An interrupted load never completes
+	if (loading)
+		removeAllListeners("load_complete");
+
+	// The files still decoding are dropped with their queue
+	list.clear();
+	decoded = std::make_shared<DecodedFiles>();
+	loaded = 0;
+	loading = false;
+
+	queueing = true;
+}
+
+void LoaderPlugin::start ()
+{
+	queueing = false;
+
+	if (loading)
+		return;
+
+	loading = true;
+
+	if (!g_config->asyncLoading)
+	{
+		// The files added by the listeners meanwhile are loaded too
+		for (std::size_t i_ = 0; i_ < list.size(); i_++)
+		{
+			auto file_ = list[i_];
+
+			file_->decode();
+			complete(*file_);
+		}
+	}
+	else
+	{
+		for (auto& file_ : list)
+			dispatch(file_);
+	}
+
+	checkComplete();
+}
+
+void LoaderPlugin::update ()
+{
+	if (!loading)
+		return;
+
+	Uint32 start_ = SDL_GetTicks();
+
+	while (true)
+	{
+		std::shared_ptr<LoaderFile> file_;
+
+		{
+			std::lock_guard<std::mutex> lock_(decoded->mutex);
+
+			if (decoded->files.empty())
+				break;
+
+			file_ = std::move(decoded->files.front());
+			decoded->files.pop_front();
+		}
+
+		complete(*file_);
+
+		// At least one file per frame
+		if (SDL_GetTicks() - start_ >= g_config->loaderBudget)
+			break;
+	}
+
+	checkComplete();
+}
+
+bool LoaderPlugin::isLoading () const
+{
+	return loading;
+}
+
+double LoaderPlugin::getProgress () const
+{
+	if (list.empty())
+		return 1.;
+
+	return static_cast<double>(loaded) / list.size();
+}
+
+void LoaderPlugin::add (std::shared_ptr<LoaderFile> file_)
+{
+	// Outside of the preload, such as in `create`
+	if (!queueing && !loading)
+	{
+		file_->decode();
+		file_->upload();
+
+		return;
+	}
+
+	list.emplace_back(file_);
+
+	if (loading && g_config->asyncLoading)
+		dispatch(file_);
+}
+
+void LoaderPlugin::dispatch (std::shared_ptr<LoaderFile> file_)
+{
+	LoaderWorkers().enqueue([file_, decoded_ = decoded] () {
+		file_->decode();
+
+		std::lock_guard<std::mutex> lock_(decoded_->mutex);
+		decoded_->files.emplace_back(file_);
+	});
+}
+
+void LoaderPlugin::complete (LoaderFile& file_)
+{
+	file_.upload();
+
+	loaded++;
+
+	emit("file_complete", std::string(file_.key));
+	emit("load_progress", getProgress());
+}
+
+void LoaderPlugin::checkComplete ()
+{
+	if (!loading || loaded < list.size())
+		return;
+
+	loading = false;
+	list.clear();
+	loaded = 0;
+
+	emit("load_complete", static_cast<Scene*>(scene));
 }
 
 }	// namespace Zen
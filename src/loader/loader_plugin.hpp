@@ -10,8 +10,13 @@
 
 #include <vector>
 #include <string>
+#include <deque>
+#include <memory>
+#include <mutex>
 
 #include "../texture/sprite_sheet_config.hpp"
+#include "../event/event_emitter.hpp"
+#include "loader_file.hpp"
 
 #include "../texture/texture_manager.fwd.hpp"
 #include "../scene/scene.fwd.hpp"
@@ -21,7 +26,24 @@
 
 namespace Zen {
 
-class LoaderPlugin
+/**
+ * Queues the files a Scene needs in its `preload`, and loads them once it
+ * is done.
+ *
+ * With `GameConfig::setAsyncLoading`, the files are read and decoded on
+ * worker threads, and their resources are created a few at a time by
+ * `update`, every frame. Otherwise they are all loaded at once by `start`.
+ * Files added outside of the `preload` are loaded right away.
+ *
+ * Events, their listeners must take these exact types:
+ * - `file_complete (std::string key)` when a file is loaded.
+ * - `load_progress (double progress)` with the loaded ratio of the queue.
+ * - `load_complete (Scene* scene)` when the whole queue is loaded.
+ *
+ * @class LoaderPlugin
+ * @since 0.0.0
+ */
+class LoaderPlugin : public EventEmitter
 {
 public:
 	/**
@@ -161,9 +183,116 @@ public:
 	/**
 	 * Resets the loader, reseting it's path and prefix too.
 	 *
+	 * The files added from then on are queued until `start` is called.
+	 *
 	 * @since 0.0.0
 	 */
 	void reset ();
+
+	/**
+	 * Starts loading the queued files.
+	 *
+	 * `load_complete` is emitted right away if there are none, or once they
+	 * are all loaded.
+	 *
+	 * @since 0.0.0
+	 */
+	void start ();
+
+	/**
+	 * Creates the resources of the files decoded so far, within the time
+	 * budget of a frame. Called by the SceneManager while the Scene loads.
+	 *
+	 * @since 0.0.0
+	 */
+	void update ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return `true` while the queued files are being loaded.
+	 */
+	bool isLoading () const;
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The ratio of the queued files that are loaded, between `0` and
+	 * `1`.
+	 */
+	double getProgress () const;
+
+	/**
+	 * The files queued since the last `reset`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::shared_ptr<LoaderFile>> list;
+
+private:
+	/**
+	 * Queues a file, or loads it right away outside of the `preload`.
+	 *
+	 * @since 0.0.0
+	 */
+	void add (std::shared_ptr<LoaderFile> file_);
+
+	/**
+	 * Decodes a file on a worker thread, then hands it to `update`.
+	 *
+	 * @since 0.0.0
+	 */
+	void dispatch (std::shared_ptr<LoaderFile> file_);
+
+	/**
+	 * Creates the resources of a decoded file and reports the progress.
+	 *
+	 * @since 0.0.0
+	 */
+	void complete (LoaderFile& file_);
+
+	/**
+	 * Emits `load_complete` once every queued file is loaded.
+	 *
+	 * @since 0.0.0
+	 */
+	void checkComplete ();
+
+	/**
+	 * The files decoded by the workers, waiting for their upload. Shared
+	 * with the workers, so that it outlives the LoaderPlugin.
+	 *
+	 * @since 0.0.0
+	 */
+	struct DecodedFiles
+	{
+		std::mutex mutex;
+
+		std::deque<std::shared_ptr<LoaderFile>> files;
+	};
+
+	std::shared_ptr<DecodedFiles> decoded = std::make_shared<DecodedFiles>();
+
+	/**
+	 * The number of queued files that are loaded.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t loaded = 0;
+
+	/**
+	 * Whether the files are queued instead of loaded right away.
+	 *
+	 * @since 0.0.0
+	 */
+	bool queueing = false;
+
+	/**
+	 * Whether the queue is being loaded.
+	 *
+	 * @since 0.0.0
+	 */
+	bool loading = false;
 };
 
 }	// namespace Zen
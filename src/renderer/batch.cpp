@@ -0,0 +1,69 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include "../window/window.hpp"
+#include "../utils/messages.hpp"
+
+namespace Zen {
+
+extern Window g_window;
+
+void Renderer::batchQuad (
+		SDL_Texture *texture_,
+		SDL_BlendMode blendMode_,
+		const SDL_FPoint quad_[4],
+		const float uv_[4],
+		const SDL_Color colors_[4])
+{
+	int quads_ = batchVertices.size() / 4;
+
+	if (texture_ != batchTexture || blendMode_ != batchBlendMode || quads_ >= batchSize)
+	{
+		flush();
+
+		batchTexture = texture_;
+		batchBlendMode = blendMode_;
+	}
+
+	// Top-left
+	batchVertices.push_back({quad_[0], colors_[0], {uv_[0], uv_[1]}});
+	// Top-right
+	batchVertices.push_back({quad_[1], colors_[1], {uv_[2], uv_[1]}});
+	// Bottom-right
+	batchVertices.push_back({quad_[2], colors_[2], {uv_[2], uv_[3]}});
+	// Bottom-left
+	batchVertices.push_back({quad_[3], colors_[3], {uv_[0], uv_[3]}});
+}
+
+void Renderer::flush ()
+{
+	if (batchVertices.empty())
+		return;
+
+	int quads_ = batchVertices.size() / 4;
+
+	setTextureBlendMode(batchTexture, batchBlendMode);
+
+	if (commandBuffer.geometry(
+				batchTexture,
+				batchVertices.data(),
+				batchVertices.size(),
+				batchIndices.data(),
+				quads_ * 6
+				))
+	{
+		MessageError("Failed to render the batch: ", SDL_GetError());
+	}
+
+	batchVertices.clear();
+
+	drawCount++;
+}
+
+}	// namespace Zen
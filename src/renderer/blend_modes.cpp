@@ -12,7 +12,7 @@ namespace Zen {
 
 void Renderer::createBlendModes ()
 {
-	blendModes[BLEND_MODE::NORMAL] = SDL_BLENDMODE_NONE;
+	blendModes[BLEND_MODE::NORMAL] = SDL_BLENDMODE_BLEND;
 
 	blendModes[BLEND_MODE::BLEND] = SDL_BLENDMODE_BLEND;
 
@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include "../window/window.hpp"
+#include "../utils/messages.hpp"
+
+namespace Zen {
+
+extern Window g_window;
+
+bool Renderer::beginCache (RenderPacket& packet_, Components::RenderCache& cache_)
+{
+	if (packet_.skip || packet_.viewport.w <= 0 || packet_.viewport.h <= 0)
+		return false;
+
+	// The texture never needs more pixels than the canvas
+	int width_ = std::min(width, std::max(1, static_cast<int>(std::lround(packet_.viewport.w * cache_.resolution))));
+	int height_ = std::min(height, std::max(1, static_cast<int>(std::lround(packet_.viewport.h * cache_.resolution))));
+
+	if (!cache_.texture || cache_.width != width_ || cache_.height != height_)
+	{
+		if (cache_.texture)
+			destroyTexture(cache_.texture);
+
+		cache_.texture = SDL_CreateTexture(
+				g_window.renderer,
+				SDL_PIXELFORMAT_RGBA8888,
+				SDL_TEXTUREACCESS_TARGET,
+				width_,
+				height_
+				);
+
+		if (!cache_.texture)
+		{
+			MessageError("Unable to create the render cache texture: ", SDL_GetError());
+
+			cache_.width = cache_.height = 0;
+			cache_.valid = false;
+
+			return false;
+		}
+
+		cache_.width = width_;
+		cache_.height = height_;
+
+		setTextureBlendMode(cache_.texture, SDL_BLENDMODE_BLEND);
+	}
+
+	cache_.viewport = packet_.viewport;
+
+	// Move the window space of the packet to the texture
+	float scaleX_ = static_cast<float>(width_) / packet_.viewport.w;
+	float scaleY_ = static_cast<float>(height_) / packet_.viewport.h;
+
+	packet_.displayScale.x *= scaleX_;
+	packet_.displayScale.y *= scaleY_;
+	packet_.displayOffset.x = (packet_.displayOffset.x - packet_.viewport.x) * scaleX_;
+	packet_.displayOffset.y = (packet_.displayOffset.y - packet_.viewport.y) * scaleY_;
+
+	// The texture is the viewport, there is nothing to clip
+	packet_.viewport = {0, 0, width_, height_};
+	packet_.clip = false;
+
+	// Anything batched so far belongs to the window
+	flush();
+
+	outputTarget = cache_.texture;
+	outputArea = packet_.viewport;
+
+	setRenderTarget(outputTarget);
+
+	setDrawColor(0x00, 0x00, 0x00, 0x00);
+	commandBuffer.clear();
+
+	return true;
+}
+
+void Renderer::endCache (Components::RenderCache& cache_)
+{
+	flush();
+
+	// Back to the window, or the internal render target
+	outputTarget = frameTarget;
+	outputArea = {0, 0, frameWidth, frameHeight};
+
+	setRenderTarget(frameTarget);
+
+	cache_.valid = true;
+}
+
+void Renderer::drawCache (const Components::RenderCache& cache_)
+{
+	if (!cache_.texture || !cache_.valid)
+		return;
+
+	// Keep the order of what was batched before
+	flush();
+
+	commandBuffer.copy(
+			cache_.texture,
+			nullptr,
+			&cache_.viewport
+			);
+}
+
+}	// namespace Zen
@@ -0,0 +1,644 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "command_buffer.hpp"
+
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+#include "../utils/messages.hpp"
+
+namespace Zen {
+
+/**
+ * The first bytes of a command file, followed by its version.
+ */
+static const char FILE_MAGIC[4] = {'Z', 'R', 'C', 'B'};
+
+static const Uint32 FILE_VERSION = 2;
+
+template <typename T>
+static bool Write (std::FILE *file_, const T& value_)
+{
+	return std::fwrite(&value_, sizeof(T), 1, file_) == 1;
+}
+
+template <typename T>
+static bool Read (std::FILE *file_, T *value_)
+{
+	return std::fread(value_, sizeof(T), 1, file_) == 1;
+}
+
+/**
+ * @return Whether a command draws to the render target, rather than setting
+ * a state.
+ */
+static bool IsDrawCommand (RENDER_COMMAND type_)
+{
+	return type_ == RENDER_COMMAND::CLEAR || type_ == RENDER_COMMAND::FILL_RECT ||
+		type_ == RENDER_COMMAND::COPY || type_ == RENDER_COMMAND::GEOMETRY;
+}
+
+/**
+ * @return The number of bytes left to read in a file.
+ */
+static Uint64 RemainingBytes (std::FILE *file_)
+{
+	long position_ = std::ftell(file_);
+
+	if (position_ < 0 || std::fseek(file_, 0, SEEK_END) != 0)
+		return 0;
+
+	long end_ = std::ftell(file_);
+	std::fseek(file_, position_, SEEK_SET);
+
+	return (end_ > position_) ? static_cast<Uint64>(end_ - position_) : 0;
+}
+
+/**
+ * The size of a command in a file, as written by `save`.
+ */
+static const Uint64 COMMAND_SIZE = sizeof(Uint32) + sizeof(Sint32) +
+	2 * sizeof(SDL_Rect) + 2 * sizeof(Uint8) + sizeof(SDL_Color) +
+	sizeof(Uint32) + 4 * sizeof(Uint64);
+
+void RenderCommandBuffer::setRenderer (SDL_Renderer *renderer_)
+{
+	renderer = renderer_;
+}
+
+void RenderCommandBuffer::setRecording (bool recording_)
+{
+	recording = recording_;
+}
+
+bool RenderCommandBuffer::isRecording () const
+{
+	return recording;
+}
+
+void RenderCommandBuffer::setDrawing (bool drawing_)
+{
+	drawing = drawing_;
+}
+
+int RenderCommandBuffer::setTarget (SDL_Texture *texture_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::TARGET;
+	command_.texture = texture_;
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::setClipRect (const SDL_Rect *rect_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::CLIP;
+
+	if (rect_)
+	{
+		command_.destination = *rect_;
+		command_.hasDestination = true;
+	}
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::setDrawColor (Uint8 red_, Uint8 green_, Uint8 blue_, Uint8 alpha_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::DRAW_COLOR;
+	command_.color = {red_, green_, blue_, alpha_};
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::setDrawBlendMode (SDL_BlendMode blendMode_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::DRAW_BLEND_MODE;
+	command_.blendMode = blendMode_;
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::setTextureBlendMode (SDL_Texture *texture_, SDL_BlendMode blendMode_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::TEXTURE_BLEND_MODE;
+	command_.texture = texture_;
+	command_.blendMode = blendMode_;
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::setTextureColorMod (SDL_Texture *texture_, Uint8 red_, Uint8 green_, Uint8 blue_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::TEXTURE_COLOR_MOD;
+	command_.texture = texture_;
+	command_.color = {red_, green_, blue_, 0xff};
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::setTextureAlphaMod (SDL_Texture *texture_, Uint8 alpha_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::TEXTURE_ALPHA_MOD;
+	command_.texture = texture_;
+	command_.color = {0xff, 0xff, 0xff, alpha_};
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::clear ()
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::CLEAR;
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::fillRect (const SDL_Rect *rect_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::FILL_RECT;
+
+	if (rect_)
+	{
+		command_.destination = *rect_;
+		command_.hasDestination = true;
+	}
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::copy (SDL_Texture *texture_, const SDL_Rect *source_, const SDL_Rect *destination_)
+{
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::COPY;
+	command_.texture = texture_;
+
+	if (source_)
+	{
+		command_.source = *source_;
+		command_.hasSource = true;
+	}
+
+	if (destination_)
+	{
+		command_.destination = *destination_;
+		command_.hasDestination = true;
+	}
+
+	return submit(command_);
+}
+
+int RenderCommandBuffer::geometry (
+		SDL_Texture *texture_,
+		const SDL_Vertex *vertices_,
+		int vertexCount_,
+		const int *indices_,
+		int indexCount_)
+{
+	if (!drawing)
+		return 0;
+
+	if (!recording)
+	{
+		return SDL_RenderGeometry(renderer, texture_,
+				vertices_, vertexCount_, indices_, indexCount_);
+	}
+
+	// Nothing changed since the previous geometry of this texture, extend it
+	if (!commands.empty() && commands.back().type == RENDER_COMMAND::GEOMETRY &&
+		commands.back().texture == texture_)
+	{
+		RenderCommand& last_ = commands.back();
+
+		for (int i_ = 0; i_ < indexCount_; i_++)
+			indices.emplace_back(indices_[i_] + static_cast<int>(last_.vertexCount));
+
+		vertices.insert(vertices.end(), vertices_, vertices_ + vertexCount_);
+
+		last_.vertexCount += vertexCount_;
+		last_.indexCount += indexCount_;
+
+		return 0;
+	}
+
+	RenderCommand command_;
+	command_.type = RENDER_COMMAND::GEOMETRY;
+	command_.texture = texture_;
+	command_.vertex = vertices.size();
+	command_.vertexCount = vertexCount_;
+	command_.index = indices.size();
+	command_.indexCount = indexCount_;
+
+	vertices.insert(vertices.end(), vertices_, vertices_ + vertexCount_);
+	indices.insert(indices.end(), indices_, indices_ + indexCount_);
+
+	commands.emplace_back(command_);
+
+	return 0;
+}
+
+int RenderCommandBuffer::execute ()
+{
+	int failures_ = 0;
+
+	for (const auto& command_ : commands)
+	{
+		if (run(command_))
+			failures_++;
+	}
+
+	return failures_;
+}
+
+void RenderCommandBuffer::reset ()
+{
+	commands.clear();
+	vertices.clear();
+	indices.clear();
+
+	for (auto texture_ : garbage)
+		SDL_DestroyTexture(texture_);
+
+	garbage.clear();
+}
+
+void RenderCommandBuffer::destroyTexture (SDL_Texture *texture_)
+{
+	if (!texture_)
+		return;
+
+	if (recording)
+		garbage.emplace_back(texture_);
+	else
+		SDL_DestroyTexture(texture_);
+}
+
+std::size_t RenderCommandBuffer::size () const
+{
+	return commands.size();
+}
+
+int RenderCommandBuffer::submit (const RenderCommand& command_)
+{
+	if (!drawing && IsDrawCommand(command_.type))
+		return 0;
+
+	if (!recording)
+		return run(command_);
+
+	commands.emplace_back(command_);
+
+	return 0;
+}
+
+int RenderCommandBuffer::run (const RenderCommand& command_)
+{
+	const SDL_Rect *source_ = command_.hasSource ? &command_.source : nullptr;
+	const SDL_Rect *destination_ = command_.hasDestination ? &command_.destination : nullptr;
+
+	switch (command_.type)
+	{
+		case RENDER_COMMAND::TARGET:
+			return SDL_SetRenderTarget(renderer, command_.texture);
+
+		case RENDER_COMMAND::CLIP:
+			return SDL_RenderSetClipRect(renderer, destination_);
+
+		case RENDER_COMMAND::DRAW_COLOR:
+			return SDL_SetRenderDrawColor(renderer,
+					command_.color.r, command_.color.g, command_.color.b, command_.color.a);
+
+		case RENDER_COMMAND::DRAW_BLEND_MODE:
+			return SDL_SetRenderDrawBlendMode(renderer, command_.blendMode);
+
+		case RENDER_COMMAND::TEXTURE_BLEND_MODE:
+			return SDL_SetTextureBlendMode(command_.texture, command_.blendMode);
+
+		case RENDER_COMMAND::TEXTURE_COLOR_MOD:
+			return SDL_SetTextureColorMod(command_.texture,
+					command_.color.r, command_.color.g, command_.color.b);
+
+		case RENDER_COMMAND::TEXTURE_ALPHA_MOD:
+			return SDL_SetTextureAlphaMod(command_.texture, command_.color.a);
+
+		case RENDER_COMMAND::CLEAR:
+			return SDL_RenderClear(renderer);
+
+		case RENDER_COMMAND::FILL_RECT:
+			return SDL_RenderFillRect(renderer, destination_);
+
+		case RENDER_COMMAND::COPY:
+			return SDL_RenderCopy(renderer, command_.texture, source_, destination_);
+
+		case RENDER_COMMAND::GEOMETRY:
+			return SDL_RenderGeometry(renderer, command_.texture,
+					&vertices[command_.vertex], command_.vertexCount,
+					&indices[command_.index], command_.indexCount);
+	}
+
+	return -1;
+}
+
+bool RenderCommandBuffer::save (const std::string& path_) const
+{
+	std::FILE *file_ = std::fopen(path_.c_str(), "wb");
+
+	if (!file_)
+	{
+		MessageError("Unable to open the render command file: ", path_);
+		return false;
+	}
+
+	// Textures are stored as indices in a table of their descriptions, the
+	// render target of the window being -1
+	std::unordered_map<SDL_Texture*, Sint32> textureIndices_;
+	std::vector<SDL_Texture*> textures_;
+
+	for (const auto& command_ : commands)
+	{
+		if (command_.texture && !textureIndices_.count(command_.texture))
+		{
+			textureIndices_.emplace(command_.texture, textures_.size());
+			textures_.emplace_back(command_.texture);
+		}
+	}
+
+	// The size of the window the commands drew to, not of a render target
+	int outputWidth_ = 0, outputHeight_ = 0;
+	SDL_Texture *target_ = SDL_GetRenderTarget(renderer);
+
+	if (target_)
+		SDL_SetRenderTarget(renderer, nullptr);
+
+	SDL_GetRendererOutputSize(renderer, &outputWidth_, &outputHeight_);
+
+	if (target_)
+		SDL_SetRenderTarget(renderer, target_);
+
+	bool ok_ = std::fwrite(FILE_MAGIC, sizeof(FILE_MAGIC), 1, file_) == 1 &&
+		Write(file_, FILE_VERSION) &&
+		Write(file_, static_cast<Sint32>(outputWidth_)) &&
+		Write(file_, static_cast<Sint32>(outputHeight_)) &&
+		Write(file_, static_cast<Uint32>(textures_.size()));
+
+	for (auto texture_ : textures_)
+	{
+		Uint32 format_ = SDL_PIXELFORMAT_UNKNOWN;
+		int access_ = 0, width_ = 0, height_ = 0;
+
+		SDL_QueryTexture(texture_, &format_, &access_, &width_, &height_);
+
+		ok_ = ok_ && Write(file_, format_) &&
+			Write(file_, static_cast<Sint32>(access_)) &&
+			Write(file_, static_cast<Sint32>(width_)) &&
+			Write(file_, static_cast<Sint32>(height_));
+	}
+
+	ok_ = ok_ && Write(file_, static_cast<Uint64>(vertices.size())) &&
+		Write(file_, static_cast<Uint64>(indices.size())) &&
+		Write(file_, static_cast<Uint64>(commands.size()));
+
+	if (ok_ && !vertices.empty())
+		ok_ = std::fwrite(vertices.data(), sizeof(SDL_Vertex), vertices.size(), file_) == vertices.size();
+
+	if (ok_ && !indices.empty())
+		ok_ = std::fwrite(indices.data(), sizeof(int), indices.size(), file_) == indices.size();
+
+	for (const auto& command_ : commands)
+	{
+		if (!ok_)
+			break;
+
+		Sint32 texture_ = command_.texture ? textureIndices_[command_.texture] : -1;
+
+		ok_ = Write(file_, static_cast<Uint32>(command_.type)) &&
+			Write(file_, texture_) &&
+			Write(file_, command_.source) &&
+			Write(file_, command_.destination) &&
+			Write(file_, static_cast<Uint8>(command_.hasSource)) &&
+			Write(file_, static_cast<Uint8>(command_.hasDestination)) &&
+			Write(file_, command_.color) &&
+			Write(file_, static_cast<Uint32>(command_.blendMode)) &&
+			Write(file_, static_cast<Uint64>(command_.vertex)) &&
+			Write(file_, static_cast<Uint64>(command_.vertexCount)) &&
+			Write(file_, static_cast<Uint64>(command_.index)) &&
+			Write(file_, static_cast<Uint64>(command_.indexCount));
+	}
+
+	if (std::fclose(file_) != 0)
+		ok_ = false;
+
+	if (!ok_)
+		MessageError("Unable to write the render command file: ", path_);
+
+	return ok_;
+}
+
+bool RenderCommandBuffer::load (const std::string& path_)
+{
+	unload();
+
+	std::FILE *file_ = std::fopen(path_.c_str(), "rb");
+
+	if (!file_)
+	{
+		MessageError("Unable to open the render command file: ", path_);
+		return false;
+	}
+
+	auto fail_ = [&] (const char *reason_) {
+		MessageError("Unable to load the render command file ", path_, ": ", reason_);
+		std::fclose(file_);
+		unload();
+
+		return false;
+	};
+
+	char magic_[4];
+	Uint32 version_ = 0, textureCount_ = 0;
+
+	if (std::fread(magic_, sizeof(magic_), 1, file_) != 1 ||
+		std::memcmp(magic_, FILE_MAGIC, sizeof(magic_)) != 0 ||
+		!Read(file_, &version_) || version_ != FILE_VERSION)
+		return fail_("not a render command file of a supported version");
+
+	if (!Read(file_, &outputWidth) || !Read(file_, &outputHeight) ||
+		!Read(file_, &textureCount_))
+		return fail_("truncated file");
+
+	if (outputWidth <= 0 || outputHeight <= 0)
+		return fail_("invalid output size");
+
+	// A format, an access and a size per texture
+	if (textureCount_ > RemainingBytes(file_) / (sizeof(Uint32) + 3 * sizeof(Sint32)))
+		return fail_("truncated file");
+
+	// Stands for the window, so that the commands drawing to it aren't
+	// clipped by the size of the window replaying them
+	outputTarget = SDL_CreateTexture(
+			renderer,
+			SDL_PIXELFORMAT_ARGB8888,
+			SDL_TEXTUREACCESS_TARGET,
+			outputWidth,
+			outputHeight
+			);
+
+	if (!outputTarget)
+		return fail_(SDL_GetError());
+
+	for (Uint32 i_ = 0; i_ < textureCount_; i_++)
+	{
+		Uint32 format_ = 0;
+		Sint32 access_ = 0, width_ = 0, height_ = 0;
+
+		if (!Read(file_, &format_) || !Read(file_, &access_) ||
+			!Read(file_, &width_) || !Read(file_, &height_))
+			return fail_("truncated file");
+
+		bool target_ = access_ == SDL_TEXTUREACCESS_TARGET;
+
+		SDL_Texture *texture_ = SDL_CreateTexture(
+				renderer,
+				format_,
+				target_ ? SDL_TEXTUREACCESS_TARGET : SDL_TEXTUREACCESS_STATIC,
+				width_,
+				height_
+				);
+
+		if (!texture_)
+			return fail_(SDL_GetError());
+
+		loadedTextures.emplace_back(texture_);
+
+		if (!target_)
+		{
+			int pitch_ = width_ * SDL_BYTESPERPIXEL(format_);
+			std::vector<Uint8> pixels_(static_cast<std::size_t>(pitch_) * height_, 0xff);
+
+			SDL_UpdateTexture(texture_, nullptr, pixels_.data(), pitch_);
+		}
+	}
+
+	Uint64 vertexCount_ = 0, indexCount_ = 0, commandCount_ = 0;
+
+	if (!Read(file_, &vertexCount_) || !Read(file_, &indexCount_) ||
+		!Read(file_, &commandCount_))
+		return fail_("truncated file");
+
+	// Checked before allocating anything, a corrupt count could be anything
+	Uint64 remaining_ = RemainingBytes(file_);
+
+	if (vertexCount_ > remaining_ / sizeof(SDL_Vertex))
+		return fail_("truncated file");
+
+	remaining_ -= vertexCount_ * sizeof(SDL_Vertex);
+
+	if (indexCount_ > remaining_ / sizeof(int))
+		return fail_("truncated file");
+
+	remaining_ -= indexCount_ * sizeof(int);
+
+	if (commandCount_ > remaining_ / COMMAND_SIZE)
+		return fail_("truncated file");
+
+	vertices.resize(vertexCount_);
+	indices.resize(indexCount_);
+
+	if ((vertexCount_ && std::fread(vertices.data(), sizeof(SDL_Vertex), vertexCount_, file_) != vertexCount_) ||
+		(indexCount_ && std::fread(indices.data(), sizeof(int), indexCount_, file_) != indexCount_))
+		return fail_("truncated file");
+
+	commands.reserve(commandCount_ + 1);
+
+	// The commands start drawing to the window
+	RenderCommand start_;
+	start_.type = RENDER_COMMAND::TARGET;
+	start_.texture = outputTarget;
+
+	commands.emplace_back(start_);
+
+	for (Uint64 i_ = 0; i_ < commandCount_; i_++)
+	{
+		RenderCommand command_;
+		Uint32 type_ = 0, blendMode_ = 0;
+		Sint32 texture_ = -1;
+		Uint8 hasSource_ = 0, hasDestination_ = 0;
+		Uint64 vertex_ = 0, vertices_ = 0, index_ = 0, indices_ = 0;
+
+		if (!Read(file_, &type_) || !Read(file_, &texture_) ||
+			!Read(file_, &command_.source) || !Read(file_, &command_.destination) ||
+			!Read(file_, &hasSource_) || !Read(file_, &hasDestination_) ||
+			!Read(file_, &command_.color) || !Read(file_, &blendMode_) ||
+			!Read(file_, &vertex_) || !Read(file_, &vertices_) ||
+			!Read(file_, &index_) || !Read(file_, &indices_))
+			return fail_("truncated file");
+
+		if (type_ > static_cast<Uint32>(RENDER_COMMAND::GEOMETRY) ||
+			texture_ < -1 || texture_ >= static_cast<Sint32>(textureCount_) ||
+			vertex_ > vertexCount_ || vertices_ > vertexCount_ - vertex_ ||
+			index_ > indexCount_ || indices_ > indexCount_ - index_ ||
+			vertices_ > static_cast<Uint64>(INT_MAX) || indices_ > static_cast<Uint64>(INT_MAX))
+			return fail_("invalid command");
+
+		command_.type = static_cast<RENDER_COMMAND>(type_);
+		command_.texture = (texture_ >= 0) ? loadedTextures[texture_] : nullptr;
+
+		if (command_.type == RENDER_COMMAND::TARGET && texture_ < 0)
+			command_.texture = outputTarget;
+		command_.hasSource = hasSource_;
+		command_.hasDestination = hasDestination_;
+		command_.blendMode = static_cast<SDL_BlendMode>(blendMode_);
+		command_.vertex = vertex_;
+		command_.vertexCount = vertices_;
+		command_.index = index_;
+		command_.indexCount = indices_;
+
+		commands.emplace_back(command_);
+	}
+
+	std::fclose(file_);
+
+	return true;
+}
+
+void RenderCommandBuffer::unload ()
+{
+	reset();
+
+	for (auto texture_ : loadedTextures)
+		SDL_DestroyTexture(texture_);
+
+	loadedTextures.clear();
+
+	if (outputTarget)
+		SDL_DestroyTexture(outputTarget);
+
+	outputTarget = nullptr;
+	outputWidth = outputHeight = 0;
+}
+
+int RenderCommandBuffer::getOutputWidth () const
+{
+	return outputWidth;
+}
+
+int RenderCommandBuffer::getOutputHeight () const
+{
+	return outputHeight;
+}
+
+}	// namespace Zen
@@ -0,0 +1,270 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_COMMANDBUFFER_HPP
+#define ZEN_RENDERER_COMMANDBUFFER_HPP
+
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "types/render_command.hpp"
+
+namespace Zen {
+
+/**
+ * The single way the Renderer talks to the SDL renderer.
+ *
+ * Each call either goes straight to SDL, or is recorded to be executed
+ * later, all at once, by `execute`. Consecutive geometry of the same texture
+ * is merged into a single command while recording.
+ *
+ * A recorded list can be saved to a file and loaded back to be replayed on
+ * its own, as a render benchmark. The contents of the textures aren't saved,
+ * only their size, format and access: a replay reproduces the cost of a
+ * frame, not its image.
+ *
+ * @class RenderCommandBuffer
+ * @since 0.0.0
+ */
+class RenderCommandBuffer
+{
+public:
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param renderer_ The SDL renderer the commands run on.
+	 */
+	void setRenderer (SDL_Renderer *renderer_);
+
+	/**
+	 * Starts or stops recording the calls instead of running them. The
+	 * commands already recorded are kept.
+	 *
+	 * @since 0.0.0
+	 */
+	void setRecording (bool recording_);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return Whether the calls are recorded.
+	 */
+	bool isRecording () const;
+
+	/**
+	 * Sets whether the draw commands, clearing, filling, copying and
+	 * geometry, are run or recorded. When not, they are dropped and return
+	 * `0`, while the state commands still apply.
+	 *
+	 * @since 0.0.0
+	 */
+	void setDrawing (bool drawing_);
+
+	/**
+	 * The calls of the SDL renderer with the same name. When recording, they
+	 * return `0`.
+	 *
+	 * @since 0.0.0
+	 */
+	int setTarget (SDL_Texture *texture_);
+
+	int setClipRect (const SDL_Rect *rect_);
+
+	int setDrawColor (Uint8 red_, Uint8 green_, Uint8 blue_, Uint8 alpha_);
+
+	int setDrawBlendMode (SDL_BlendMode blendMode_);
+
+	int setTextureBlendMode (SDL_Texture *texture_, SDL_BlendMode blendMode_);
+
+	int setTextureColorMod (SDL_Texture *texture_, Uint8 red_, Uint8 green_, Uint8 blue_);
+
+	int setTextureAlphaMod (SDL_Texture *texture_, Uint8 alpha_);
+
+	int clear ();
+
+	int fillRect (const SDL_Rect *rect_);
+
+	int copy (SDL_Texture *texture_, const SDL_Rect *source_, const SDL_Rect *destination_);
+
+	int geometry (
+			SDL_Texture *texture_,
+			const SDL_Vertex *vertices_,
+			int vertexCount_,
+			const int *indices_,
+			int indexCount_);
+
+	/**
+	 * Runs every recorded command, in order. The commands are kept, so that
+	 * they can be run again.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The number of commands that failed.
+	 */
+	int execute ();
+
+	/**
+	 * Forgets every recorded command, keeping the allocated memory, and
+	 * destroys the textures given to `destroyTexture` while recording.
+	 *
+	 * @since 0.0.0
+	 */
+	void reset ();
+
+	/**
+	 * Destroys a texture once the commands recorded so far, which may still
+	 * use it, are done with: when recording, it is destroyed by the next
+	 * `reset`.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture_ The texture to destroy.
+	 */
+	void destroyTexture (SDL_Texture *texture_);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The number of recorded commands.
+	 */
+	std::size_t size () const;
+
+	/**
+	 * Writes the recorded commands to a file.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param path_ The file to write.
+	 *
+	 * @return `false` if the file couldn't be written.
+	 */
+	bool save (const std::string& path_) const;
+
+	/**
+	 * Replaces the recorded commands with the ones of a file, creating a
+	 * texture of the same size, format and access for each one they use.
+	 * The textures are filled with opaque white.
+	 *
+	 * The commands that drew to the window draw to a render target of the
+	 * size of its output instead, as saved in the file.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param path_ The file to read.
+	 *
+	 * @return `false` if the file couldn't be read or a texture created.
+	 */
+	bool load (const std::string& path_);
+
+	/**
+	 * Destroys the textures created by `load`, and forgets the commands.
+	 *
+	 * This must happen before the SDL renderer is destroyed.
+	 *
+	 * @since 0.0.0
+	 */
+	void unload ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The width of the output of the loaded commands, in pixels.
+	 */
+	int getOutputWidth () const;
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The height of the output of the loaded commands, in pixels.
+	 */
+	int getOutputHeight () const;
+
+private:
+	/**
+	 * Runs a single command.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The result of the SDL call.
+	 */
+	int run (const RenderCommand& command_);
+
+	/**
+	 * Runs a command immediately, or records it.
+	 *
+	 * @since 0.0.0
+	 */
+	int submit (const RenderCommand& command_);
+
+	/**
+	 * @since 0.0.0
+	 */
+	SDL_Renderer *renderer = nullptr;
+
+	/**
+	 * @since 0.0.0
+	 */
+	bool recording = false;
+
+	/**
+	 * @since 0.0.0
+	 */
+	bool drawing = true;
+
+	/**
+	 * @since 0.0.0
+	 */
+	std::vector<RenderCommand> commands;
+
+	/**
+	 * The vertices of every `GEOMETRY` command.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SDL_Vertex> vertices;
+
+	/**
+	 * The indices of every `GEOMETRY` command.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<int> indices;
+
+	/**
+	 * The textures created by `load`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SDL_Texture*> loadedTextures;
+
+	/**
+	 * The render target created by `load` in place of the window.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Texture *outputTarget = nullptr;
+
+	/**
+	 * The output size of the loaded commands.
+	 *
+	 * @since 0.0.0
+	 */
+	Sint32 outputWidth = 0, outputHeight = 0;
+
+	/**
+	 * The textures to destroy on the next `reset`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SDL_Texture*> garbage;
+};
+
+}	// namespace Zen
+
+#endif
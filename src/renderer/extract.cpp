@@ -0,0 +1,422 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include <unordered_map>
+
+#include "../scale/scale_manager.hpp"
+
+#include "../math/deg_to_rad.hpp"
+#include "../geom/rectangle.hpp"
+#include "../systems/position.hpp"
+#include "../systems/size.hpp"
+#include "../systems/viewport.hpp"
+#include "../systems/mask.hpp"
+#include "../systems/transparent.hpp"
+#include "../systems/background_color.hpp"
+#include "../systems/alpha.hpp"
+#include "../systems/origin.hpp"
+#include "../systems/textured.hpp"
+#include "../systems/flip.hpp"
+#include "../systems/transform_matrix.hpp"
+#include "../systems/scale.hpp"
+#include "../systems/rotation.hpp"
+#include "../systems/scroll_factor.hpp"
+#include "../systems/scroll.hpp"
+#include "../systems/blend_mode.hpp"
+#include "../systems/renderable.hpp"
+#include "../systems/text.hpp"
+#include "../texture/systems/frame.hpp"
+#include "../texture/systems/source.hpp"
+#include "../texture/components/frame.hpp"
+#include "../texture/components/source.hpp"
+#include "../components/tint.hpp"
+#include "../components/alpha.hpp"
+#include "../components/cull.hpp"
+#include "../cameras/2d/systems/camera.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+extern ScaleManager g_scale;
+
+void Renderer::extract (
+		const std::vector<Entity>& children_,
+		Entity camera_,
+		RenderPacket& packet_,
+		bool visible_)
+{
+	packet_.clear();
+	packet_.camera = camera_;
+
+	SDL_Rect c_;
+	c_.x = GetX(camera_);
+	c_.y = GetY(camera_);
+	c_.w = GetWidth(camera_);
+	c_.h = GetHeight(camera_);
+
+	bool viewport_ = GetViewport(camera_);
+
+	if (viewport_ || g_scale.scaleMode != SCALE_MODE::RESIZE)
+	{
+		// Skip rendering this camera if its viewport is outside the window
+		if (c_.x > width || c_.y > height || c_.x < -c_.w || c_.y < -c_.h)
+		{
+			packet_.skip = true;
+			return;
+		}
+
+		// Clip the viewport if it goes outside the left side of the window
+		if (c_.x < 0)
+		{
+			c_.w += c_.x;
+			c_.x = 0;
+		}
+
+		// Clip the viewport if it goes outside the right side of the window
+		if ((c_.x + c_.w) > width)
+		{
+			c_.w = width - c_.x;
+		}
+
+		// Clip the viewport if it goes outside the top side of the window
+		if (c_.y < 0)
+		{
+			c_.h += c_.y;
+			c_.y = 0;
+		}
+
+		// Clip the viewport if it goes outside the bottom side of the window
+		if ((c_.y + c_.h) > height)
+		{
+			c_.h = height - c_.y;
+		}
+
+		packet_.clip = true;
+	}
+
+	c_.x *= g_scale.renderScale.x;
+	c_.y *= g_scale.renderScale.y;
+	c_.w *= g_scale.renderScale.x;
+	c_.h *= g_scale.renderScale.y;
+	c_.x += g_scale.renderOffset.x;
+	c_.y += g_scale.renderOffset.y;
+
+	packet_.viewport = c_;
+
+	packet_.displayScale = {
+		static_cast<float>(g_scale.renderScale.x),
+		static_cast<float>(g_scale.renderScale.y)
+	};
+	packet_.displayOffset = {
+		static_cast<float>(g_scale.renderOffset.x),
+		static_cast<float>(g_scale.renderOffset.y)
+	};
+
+	auto cull_ = g_registry.try_get<Components::Cull>(camera_);
+	packet_.cull = cull_ && cull_->value;
+
+	packet_.viewMatrices.emplace_back(GetTransformMatrix(camera_));
+
+	// Camera's background color
+	packet_.transparent = IsTransparent(camera_);
+
+	if (!packet_.transparent)
+	{
+		auto bgc = GetBackgroundColor(camera_);
+
+		packet_.background.r = bgc.red;
+		packet_.background.g = bgc.green;
+		packet_.background.b = bgc.blue;
+		packet_.background.a = bgc.alpha * GetAlpha(camera_);
+	}
+
+	// Masks are extracted once every drawn record is known, as they must be
+	// stored after them
+	std::vector<std::pair<int, Entity>> masks_;
+	std::vector<std::pair<int, Rectangle>> rectMasks_;
+
+	for (auto& child_ : children_)
+	{
+		if (child_ == entt::null || (!visible_ && !WillRender(child_, camera_)))
+			continue;
+
+		// !!! TEXT LAB !!!
+		if (IsText(child_))
+		{
+			packet_.add(RENDER_RECORD::TEXT, child_);
+			continue;
+		}
+		// !!! TEXT LAB !!!
+
+		AddToRenderList(camera_, child_);
+
+		Entity frame_ = GetFrame(child_);
+
+		if (frame_ == entt::null)
+			continue;
+
+		int index_ = extractSprite(child_, frame_, camera_, GetParentTransformMatrix(child_), packet_);
+
+		if (index_ < 0)
+			continue;
+
+		Rectangle rect_ = GetRectMask(child_);
+
+		if (GetMask(child_) != entt::null)
+			masks_.emplace_back(index_, GetMask(child_));
+		else if (!IsEmpty(&rect_))
+			rectMasks_.emplace_back(index_, rect_);
+	}
+
+	packet_.count = packet_.size();
+
+	// Game Objects sharing a mask share its record, so that the renderer can
+	// mask consecutive ones in a single pass
+	std::unordered_map<Entity, int> extracted_;
+
+	for (auto& [index_, mask_] : masks_)
+	{
+		auto it_ = extracted_.find(mask_);
+
+		if (it_ == extracted_.end())
+			it_ = extracted_.emplace(mask_, extractMask(mask_, camera_, packet_)).first;
+
+		packet_.masks[index_] = it_->second;
+	}
+
+	for (auto& [index_, rect_] : rectMasks_)
+		packet_.masks[index_] = extractRectMask(rect_, camera_, packet_);
+
+	Rectangle cameraRect_ = GetRectMask(camera_);
+
+	if (GetMask(camera_) != entt::null)
+		packet_.mask = extractMask(GetMask(camera_), camera_, packet_);
+	else if (!IsEmpty(&cameraRect_))
+		packet_.mask = extractRectMask(cameraRect_, camera_, packet_);
+}
+
+int Renderer::extractRectMask (
+		const Rectangle& rect_,
+		Entity camera_,
+		RenderPacket& packet_)
+{
+	std::size_t i_ = packet_.add(RENDER_RECORD::RECT, entt::null);
+
+	packet_.translateX[i_] = rect_.x - GetScrollX(camera_);
+	packet_.translateY[i_] = rect_.y - GetScrollY(camera_);
+	packet_.sizes[i_] = {
+		static_cast<float>(rect_.width),
+		static_cast<float>(rect_.height)
+	};
+
+	return i_;
+}
+
+int Renderer::extractMask (
+		Entity mask_,
+		Entity camera_,
+		RenderPacket& packet_)
+{
+	Entity frame_ = GetFrame(mask_);
+
+	if (frame_ == entt::null)
+		return -1;
+
+	AddToRenderList(camera_, mask_);
+
+	return extractSprite(mask_, frame_, camera_, GetParentTransformMatrix(mask_), packet_);
+}
+
+int Renderer::extractSprite (
+		Entity sprite_,
+		Entity frame_,
+		Entity camera_,
+		Components::TransformMatrix *parentTransformMatrix_,
+		RenderPacket& packet_)
+{
+	double cameraAlpha_ = GetAlpha(camera_);
+	double alpha_ = cameraAlpha_ * GetAlpha(sprite_);
+
+	if (!alpha_)
+		// Nothing to see, so abort early
+		return -1;
+
+	Rectangle dd_ = GetFrameDrawImageData(frame_);
+
+	auto cut = GetFrameCut(frame_);
+
+	// FIXME Stop cheating and implement correct components to frames
+	const auto& frameCheat___ = g_registry.get<Components::Frame>(frame_);
+
+	double frameX_ = dd_.x;
+	double frameY_ = dd_.y;
+	double frameWidth_;
+	double frameHeight_;
+
+	if (frameCheat___.rotated)
+	{
+		frameWidth_ = cut.height;
+		frameHeight_ = cut.width;
+	}
+	else
+	{
+		frameWidth_ = cut.width;
+		frameHeight_ = cut.height;
+	}
+
+	// FIXME AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+	double res_ = 1.0; // frame___.source->resolution;
+
+	double displayOriginX_ = GetDisplayOriginX(sprite_);
+	double displayOriginY_ = GetDisplayOriginY(sprite_);
+
+	double x_ = (-1. * displayOriginX_) + frameCheat___.data.spriteSourceSize.x;
+	double y_ = (-1. * displayOriginY_) + frameCheat___.data.spriteSourceSize.y;
+
+	bool flipX_ = GetFlipX(sprite_);
+	bool flipY_ = GetFlipY(sprite_);
+	bool cropped_ = IsCropped(sprite_);
+
+	if (cropped_)
+	{
+		auto crop_ = GetCrop(sprite_);
+
+		if (crop_.flipX != flipX_ || crop_.flipY != flipY_)
+			UpdateFrameCropUVs(frame_, &crop_, flipX_, flipY_);
+
+		frameWidth_ = crop_.cw;
+		frameHeight_ = crop_.ch;
+
+		frameX_ = crop_.cx;
+		frameY_ = crop_.cy;
+
+		x_ = -displayOriginX_ + crop_.x;
+		y_ = -displayOriginY_ + crop_.y;
+
+		if (flipX_) {
+			if (x_ >= 0)
+				x_ = -(x_ + frameWidth_);
+			else
+				x_ = (std::abs(x_) - frameWidth_);
+		}
+
+		if (flipY_) {
+			if (y_ >= 0)
+				y_ = -(y_ + frameHeight_);
+			else
+				y_ = (std::abs(y_) - frameHeight_);
+		}
+	}
+
+	double spriteX_ = GetX(sprite_);
+	double spriteY_ = GetY(sprite_);
+	double rotation_ = GetRotation(sprite_);
+
+	if (frameCheat___.rotated)
+	{
+		y_ += frameCheat___.height;
+		rotation_ += Math::DegToRad(-90);
+	}
+
+	double scrollX_ = GetScrollX(camera_) * GetScrollFactorX(sprite_);
+	double scrollY_ = GetScrollY(camera_) * GetScrollFactorY(sprite_);
+
+	int view_ = 0;
+	double translateX_;
+	double translateY_;
+
+	if (parentTransformMatrix_)
+	{
+		// Multiply the camera by the parent matrix
+		auto& viewMatrix_ = tempMatrix1;
+		viewMatrix_ = packet_.viewMatrices[0];
+
+		MultiplyWithOffset(&viewMatrix_, *parentTransformMatrix_, -scrollX_, -scrollY_);
+
+		view_ = packet_.viewMatrices.size();
+		packet_.viewMatrices.emplace_back(viewMatrix_);
+
+		// The camera scroll is part of the view
+		translateX_ = spriteX_;
+		translateY_ = spriteY_;
+	}
+	else
+	{
+		translateX_ = spriteX_ + x_ - scrollX_;
+		translateY_ = spriteY_ + y_ - scrollY_;
+	}
+
+	// FIXME AAAAAAAAAAAAAAAAAAAAAa
+	const auto& source___ = g_registry.get<Components::TextureSource>(frameCheat___.source);
+
+	std::size_t i_ = packet_.add(RENDER_RECORD::SPRITE, sprite_);
+
+	// Stamped as used, and loaded again if it was released
+	packet_.textures[i_] = UseTextureSource(frameCheat___.source, frameCount);
+	packet_.opaque[i_] = frameCheat___.opaque;
+	packet_.views[i_] = view_;
+	packet_.translateX[i_] = translateX_;
+	packet_.translateY[i_] = translateY_;
+	packet_.rotation[i_] = rotation_;
+	packet_.scaleX[i_] = GetScaleX(sprite_);
+	packet_.scaleY[i_] = GetScaleY(sprite_);
+	packet_.sizes[i_] = {
+		static_cast<float>(frameWidth_ / res_),
+		static_cast<float>(frameHeight_ / res_)
+	};
+
+	// Texture coordinates
+	auto& uv_ = packet_.uvs[i_];
+	if (cropped_)
+	{
+		uv_[0] = frameX_ / source___.width;
+		uv_[1] = frameY_ / source___.height;
+		uv_[2] = (frameX_ + frameWidth_) / source___.width;
+		uv_[3] = (frameY_ + frameHeight_) / source___.height;
+	}
+	else
+	{
+		// Rotated frames have inverted UVs, the rotation itself is already
+		// applied by the sprite matrix
+		uv_[0] = std::min(frameCheat___.u0, frameCheat___.u1);
+		uv_[1] = std::min(frameCheat___.v0, frameCheat___.v1);
+		uv_[2] = std::max(frameCheat___.u0, frameCheat___.u1);
+		uv_[3] = std::max(frameCheat___.v0, frameCheat___.v1);
+	}
+
+	packet_.flips[i_] = (flipX_ ? RENDER_FLIP_X : RENDER_FLIP_NONE) |
+		(flipY_ ? RENDER_FLIP_Y : RENDER_FLIP_NONE);
+
+	// Tint (Color Modulation) and Alpha (Transparency) of each corner
+	auto [tint_, alphas_] = g_registry.try_get<Components::Tint, Components::Alpha>(sprite_);
+
+	if (tint_)
+		packet_.tints[i_] = {tint_->tl, tint_->tr, tint_->br, tint_->bl};
+
+	if (alphas_)
+	{
+		packet_.alphas[i_] = {
+			static_cast<float>(cameraAlpha_ * alphas_->tl),
+			static_cast<float>(cameraAlpha_ * alphas_->tr),
+			static_cast<float>(cameraAlpha_ * alphas_->br),
+			static_cast<float>(cameraAlpha_ * alphas_->bl)
+		};
+	}
+	else
+	{
+		float a_ = alpha_;
+		packet_.alphas[i_] = {a_, a_, a_, a_};
+	}
+
+	packet_.blendModes[i_] = blendModes[GetBlendMode(sprite_)];
+
+	return i_;
+}
+
+}	// namespace Zen
@@ -0,0 +1,425 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "frame_capture.hpp"
+
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include "../utils/messages.hpp"
+
+namespace Zen {
+
+FrameCapture::~FrameCapture ()
+{
+	stop();
+}
+
+bool FrameCapture::start (const CaptureConfig& config_, int width_, int height_)
+{
+	stop();
+
+	if (width_ <= 0 || height_ <= 0)
+	{
+		MessageError("Unable to capture an empty window.");
+		return false;
+	}
+
+	config = config_;
+	config.interval = std::max(config.interval, 1);
+	config.ringSize = std::max(config.ringSize, 1);
+	config.frameRate = std::max(config.frameRate, 1);
+
+	area = {0, 0, width_, height_};
+
+	for (int i_ = 0; i_ < config.ringSize; i_++)
+	{
+		Slot slot_;
+		slot_.surface = SDL_CreateRGBSurfaceWithFormat(
+				0, width_, height_, 32, SDL_PIXELFORMAT_ARGB8888);
+
+		if (!slot_.surface)
+		{
+			MessageError("Failed to create the capture ring: ", SDL_GetError());
+			release();
+			return false;
+		}
+
+		ring.emplace_back(slot_);
+	}
+
+	if (config.format == CAPTURE_FORMAT::Y4M)
+	{
+		stream = std::fopen(config.path.c_str(), "wb");
+
+		if (!stream)
+		{
+			MessageError("Failed to open the capture stream: ", config.path);
+			release();
+			return false;
+		}
+
+		std::fprintf(stream, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n",
+				width_, height_, config.frameRate);
+	}
+
+	head = tail = frameCount = 0;
+	captured = written = dropped = 0;
+
+	stopping = false;
+	running = true;
+
+	writer = std::thread(&FrameCapture::write, this);
+
+	return true;
+}
+
+void FrameCapture::stop ()
+{
+	if (!running)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock_(mutex);
+		stopping = true;
+	}
+
+	condition.notify_one();
+
+	writer.join();
+
+	release();
+
+	running = false;
+}
+
+bool FrameCapture::isRunning () const
+{
+	return running;
+}
+
+void FrameCapture::grab (SDL_Renderer *renderer_)
+{
+	if (!running)
+		return;
+
+	unsigned long frame_ = frameCount++;
+
+	if (frame_ % config.interval != 0)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock_(mutex);
+
+		// The writer is behind, drop the frame rather than wait for it
+		if (head - tail >= ring.size())
+		{
+			dropped++;
+			return;
+		}
+	}
+
+	// Only the writer touches the slots between `tail` and `head`
+	Slot& slot_ = ring[head % ring.size()];
+
+	if (SDL_RenderReadPixels(
+				renderer_,
+				&area,
+				SDL_PIXELFORMAT_ARGB8888,
+				slot_.surface->pixels,
+				slot_.surface->pitch))
+	{
+		dropped++;
+		return;
+	}
+
+	slot_.frame = frame_;
+	captured++;
+
+	{
+		std::lock_guard<std::mutex> lock_(mutex);
+		head++;
+	}
+
+	condition.notify_one();
+}
+
+CaptureStats FrameCapture::getStats () const
+{
+	CaptureStats stats_;
+
+	stats_.captured = captured;
+	stats_.written = written;
+	stats_.dropped = dropped;
+
+	return stats_;
+}
+
+void FrameCapture::write ()
+{
+	while (true)
+	{
+		unsigned long index_;
+
+		{
+			std::unique_lock<std::mutex> lock_(mutex);
+
+			condition.wait(lock_, [this] () {
+				return stopping || tail != head;
+			});
+
+			// Stopping, and every frame was written
+			if (tail == head)
+				return;
+
+			index_ = tail;
+		}
+
+		if (encode(ring[index_ % ring.size()]))
+			written++;
+		else
+			dropped++;
+
+		{
+			std::lock_guard<std::mutex> lock_(mutex);
+			tail++;
+		}
+	}
+}
+
+bool FrameCapture::encode (const Slot& slot_)
+{
+	if (config.format == CAPTURE_FORMAT::Y4M)
+		return encodeY4M(slot_.surface);
+
+	char number_[32];
+	std::snprintf(number_, sizeof(number_), "%06lu", slot_.frame);
+
+	std::string path_ = config.path + number_;
+
+	if (config.format == CAPTURE_FORMAT::QOI)
+		return encodeQOI(slot_.surface, (path_ + ".qoi").c_str());
+
+	path_ += ".png";
+
+	if (IMG_SavePNG(slot_.surface, path_.c_str()))
+	{
+		MessageError("Failed to save the captured frame: ", IMG_GetError());
+		return false;
+	}
+
+	return true;
+}
+
+bool FrameCapture::encodeQOI (SDL_Surface *surface_, const char *path_)
+{
+	const int width_ = surface_->w;
+	const int height_ = surface_->h;
+
+	buffer.clear();
+
+	auto put32_ = [this] (Uint32 value_) {
+		buffer.emplace_back(value_ >> 24);
+		buffer.emplace_back(value_ >> 16);
+		buffer.emplace_back(value_ >> 8);
+		buffer.emplace_back(value_);
+	};
+
+	// Header: magic, size, 4 channels, sRGB with linear alpha
+	buffer.insert(buffer.end(), {'q', 'o', 'i', 'f'});
+	put32_(width_);
+	put32_(height_);
+	buffer.emplace_back(4);
+	buffer.emplace_back(0);
+
+	Uint8 index_[64][4] = {};
+	Uint8 previous_[4] = {0, 0, 0, 255};
+	int run_ = 0;
+
+	const long last_ = static_cast<long>(width_) * height_ - 1;
+	long position_ = 0;
+
+	for (int y_ = 0; y_ < height_; y_++)
+	{
+		const Uint32 *row_ = reinterpret_cast<const Uint32*>(
+				static_cast<const Uint8*>(surface_->pixels) + y_ * surface_->pitch);
+
+		for (int x_ = 0; x_ < width_; x_++, position_++)
+		{
+			Uint8 pixel_[4] = {
+				static_cast<Uint8>(row_[x_] >> 16),
+				static_cast<Uint8>(row_[x_] >> 8),
+				static_cast<Uint8>(row_[x_]),
+				static_cast<Uint8>(row_[x_] >> 24)
+			};
+
+			if (std::equal(pixel_, pixel_ + 4, previous_))
+			{
+				run_++;
+
+				if (run_ == 62 || position_ == last_)
+				{
+					buffer.emplace_back(0xc0 | (run_ - 1));
+					run_ = 0;
+				}
+
+				continue;
+			}
+
+			if (run_ > 0)
+			{
+				buffer.emplace_back(0xc0 | (run_ - 1));
+				run_ = 0;
+			}
+
+			int hash_ = (pixel_[0] * 3 + pixel_[1] * 5 + pixel_[2] * 7 + pixel_[3] * 11) % 64;
+
+			if (std::equal(pixel_, pixel_ + 4, index_[hash_]))
+			{
+				buffer.emplace_back(hash_);
+			}
+			else
+			{
+				std::copy(pixel_, pixel_ + 4, index_[hash_]);
+
+				if (pixel_[3] == previous_[3])
+				{
+					int dr_ = static_cast<signed char>(pixel_[0] - previous_[0]);
+					int dg_ = static_cast<signed char>(pixel_[1] - previous_[1]);
+					int db_ = static_cast<signed char>(pixel_[2] - previous_[2]);
+
+					int drg_ = dr_ - dg_;
+					int dbg_ = db_ - dg_;
+
+					if (dr_ > -3 && dr_ < 2 && dg_ > -3 && dg_ < 2 && db_ > -3 && db_ < 2)
+					{
+						buffer.emplace_back(0x40 | (dr_ + 2) << 4 | (dg_ + 2) << 2 | (db_ + 2));
+					}
+					else if (drg_ > -9 && drg_ < 8 && dg_ > -33 && dg_ < 32 && dbg_ > -9 && dbg_ < 8)
+					{
+						buffer.emplace_back(0x80 | (dg_ + 32));
+						buffer.emplace_back((drg_ + 8) << 4 | (dbg_ + 8));
+					}
+					else
+					{
+						buffer.insert(buffer.end(), {0xfe, pixel_[0], pixel_[1], pixel_[2]});
+					}
+				}
+				else
+				{
+					buffer.insert(buffer.end(), {0xff, pixel_[0], pixel_[1], pixel_[2], pixel_[3]});
+				}
+			}
+
+			std::copy(pixel_, pixel_ + 4, previous_);
+		}
+	}
+
+	// End marker
+	buffer.insert(buffer.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+
+	std::FILE *file_ = std::fopen(path_, "wb");
+
+	if (!file_)
+	{
+		MessageError("Failed to open the captured frame file: ", path_);
+		return false;
+	}
+
+	bool success_ = std::fwrite(buffer.data(), 1, buffer.size(), file_) == buffer.size();
+
+	std::fclose(file_);
+
+	return success_;
+}
+
+bool FrameCapture::encodeY4M (SDL_Surface *surface_)
+{
+	const int width_ = surface_->w;
+	const int height_ = surface_->h;
+	const int chromaWidth_ = (width_ + 1) / 2;
+	const int chromaHeight_ = (height_ + 1) / 2;
+
+	const std::size_t lumaSize_ = static_cast<std::size_t>(width_) * height_;
+	const std::size_t chromaSize_ = static_cast<std::size_t>(chromaWidth_) * chromaHeight_;
+
+	buffer.resize(lumaSize_ + chromaSize_ * 2);
+
+	Uint8 *luma_ = buffer.data();
+	Uint8 *cb_ = luma_ + lumaSize_;
+	Uint8 *cr_ = cb_ + chromaSize_;
+
+	auto pixel_ = [surface_] (int x_, int y_) {
+		return reinterpret_cast<const Uint32*>(
+				static_cast<const Uint8*>(surface_->pixels) + y_ * surface_->pitch)[x_];
+	};
+
+	// Full range BT.601, as in JPEG, in 8 bits fixed point
+	for (int y_ = 0; y_ < height_; y_++)
+	{
+		for (int x_ = 0; x_ < width_; x_++)
+		{
+			Uint32 p_ = pixel_(x_, y_);
+			int r_ = (p_ >> 16) & 0xff, g_ = (p_ >> 8) & 0xff, b_ = p_ & 0xff;
+
+			luma_[y_ * width_ + x_] = (77 * r_ + 150 * g_ + 29 * b_ + 128) >> 8;
+		}
+	}
+
+	// The chroma of each 2x2 block is the one of its average color
+	for (int y_ = 0; y_ < chromaHeight_; y_++)
+	{
+		for (int x_ = 0; x_ < chromaWidth_; x_++)
+		{
+			int r_ = 0, g_ = 0, b_ = 0, count_ = 0;
+
+			for (int sy_ = y_ * 2; sy_ < std::min(y_ * 2 + 2, height_); sy_++)
+			{
+				for (int sx_ = x_ * 2; sx_ < std::min(x_ * 2 + 2, width_); sx_++)
+				{
+					Uint32 p_ = pixel_(sx_, sy_);
+					r_ += (p_ >> 16) & 0xff;
+					g_ += (p_ >> 8) & 0xff;
+					b_ += p_ & 0xff;
+					count_++;
+				}
+			}
+
+			r_ /= count_;
+			g_ /= count_;
+			b_ /= count_;
+
+			// Offset by 128 << 8 so that the shift is on a positive value
+			cb_[y_ * chromaWidth_ + x_] = std::min(255, (-43 * r_ - 85 * g_ + 128 * b_ + 32896) >> 8);
+			cr_[y_ * chromaWidth_ + x_] = std::min(255, (128 * r_ - 107 * g_ - 21 * b_ + 32896) >> 8);
+		}
+	}
+
+	if (std::fputs("FRAME\n", stream) < 0 ||
+		std::fwrite(buffer.data(), 1, buffer.size(), stream) != buffer.size())
+	{
+		MessageError("Failed to write the captured frame to the stream.");
+		return false;
+	}
+
+	return true;
+}
+
+void FrameCapture::release ()
+{
+	for (auto& slot_ : ring)
+		SDL_FreeSurface(slot_.surface);
+
+	ring.clear();
+
+	if (stream)
+	{
+		std::fclose(stream);
+		stream = nullptr;
+	}
+}
+
+}	// namespace Zen
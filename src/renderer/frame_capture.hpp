@@ -0,0 +1,211 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_FRAMECAPTURE_HPP
+#define ZEN_RENDERER_FRAMECAPTURE_HPP
+
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types/capture_config.hpp"
+
+namespace Zen {
+
+/**
+ * Records the rendered frames to disk, from a writer thread.
+ *
+ * The frames are read into a ring of surfaces allocated when the capture
+ * starts, so recording allocates nothing. If the writer falls behind and the
+ * ring is full, the new frames are dropped and counted instead of waiting
+ * for it.
+ *
+ * @class FrameCapture
+ * @since 0.0.0
+ */
+class FrameCapture
+{
+public:
+	/**
+	 * Stops the capture, writing the frames left in the ring.
+	 *
+	 * @since 0.0.0
+	 */
+	~FrameCapture ();
+
+	/**
+	 * Starts recording the window. A capture already running is stopped
+	 * first.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param config_ The capture settings.
+	 * @param width_ The width of the window, in pixels.
+	 * @param height_ The height of the window, in pixels.
+	 *
+	 * @return `false` if the ring or the output couldn't be created.
+	 */
+	bool start (const CaptureConfig& config_, int width_, int height_);
+
+	/**
+	 * Stops recording, and waits for the writer to write the frames left in
+	 * the ring.
+	 *
+	 * @since 0.0.0
+	 */
+	void stop ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return Whether a capture is running.
+	 */
+	bool isRunning () const;
+
+	/**
+	 * Reads the current frame from the window into the ring, if it is one of
+	 * the frames to capture and a slot is free.
+	 *
+	 * This must run once per frame, before the frame is presented.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param renderer_ The SDL renderer to read from.
+	 */
+	void grab (SDL_Renderer *renderer_);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The counters of the current or last capture.
+	 */
+	CaptureStats getStats () const;
+
+private:
+	/**
+	 * A pre-allocated frame of the ring.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Slot
+	{
+		SDL_Surface *surface = nullptr;
+
+		/**
+		 * The number of the frame, used to name the file.
+		 */
+		unsigned long frame = 0;
+	};
+
+	/**
+	 * The loop of the writer thread.
+	 *
+	 * @since 0.0.0
+	 */
+	void write ();
+
+	/**
+	 * Writes a frame in the output format.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return `true` on success.
+	 */
+	bool encode (const Slot& slot_);
+
+	/**
+	 * Writes a frame as a QOI image file.
+	 *
+	 * @since 0.0.0
+	 */
+	bool encodeQOI (SDL_Surface *surface_, const char *path_);
+
+	/**
+	 * Writes a frame as a YUV4MPEG2 frame to the stream.
+	 *
+	 * @since 0.0.0
+	 */
+	bool encodeY4M (SDL_Surface *surface_);
+
+	/**
+	 * Frees the ring.
+	 *
+	 * @since 0.0.0
+	 */
+	void release ();
+
+	/**
+	 * @since 0.0.0
+	 */
+	CaptureConfig config;
+
+	/**
+	 * The area of the window recorded.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Rect area {0, 0, 0, 0};
+
+	/**
+	 * @since 0.0.0
+	 */
+	std::vector<Slot> ring;
+
+	/**
+	 * The total number of frames pushed to and popped from the ring. The
+	 * slot of a frame is its number modulo the size of the ring.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned long head = 0, tail = 0;
+
+	/**
+	 * The number of frames rendered since the capture started.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned long frameCount = 0;
+
+	/**
+	 * The Y4M stream.
+	 *
+	 * @since 0.0.0
+	 */
+	std::FILE *stream = nullptr;
+
+	/**
+	 * The encoded bytes of a frame, reused for every frame.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Uint8> buffer;
+
+	std::atomic<unsigned long> captured {0}, written {0}, dropped {0};
+
+	/**
+	 * Guards `head`, `tail` and `stopping`.
+	 *
+	 * @since 0.0.0
+	 */
+	mutable std::mutex mutex;
+
+	std::condition_variable condition;
+
+	bool running = false;
+
+	bool stopping = false;
+
+	std::thread writer;
+};
+
+}	// namespace Zen
+
+#endif
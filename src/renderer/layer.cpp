@@ -0,0 +1,87 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include <algorithm>
+#include "../window/window.hpp"
+#include "../components/static_layer.hpp"
+#include "../components/render_texture.hpp"
+#include "../cameras/2d/systems/camera.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+extern Window g_window;
+
+void Renderer::renderLayers (Scene& scene_)
+{
+	auto view_ = g_registry.view<Components::StaticLayer, Components::RenderTexture>();
+
+	for (auto entity_ : view_)
+	{
+		auto& layer_ = view_.get<Components::StaticLayer>(entity_);
+		auto& renderTexture_ = view_.get<Components::RenderTexture>(entity_);
+
+		if (!layer_.dirty || !renderTexture_.texture)
+			continue;
+
+		// Members destroyed since the last render
+		auto& members_ = layer_.members;
+		members_.erase(std::remove_if(members_.begin(), members_.end(),
+					[] (Entity member_) { return !g_registry.valid(member_); }),
+				members_.end());
+
+		PreRender(layer_.camera);
+
+		extract(members_, layer_.camera, layerPacket);
+
+		// The texture is the whole viewport, unscaled
+		SDL_Rect area_ {0, 0, renderTexture_.width, renderTexture_.height};
+
+		layerPacket.skip = false;
+		layerPacket.clip = false;
+		layerPacket.viewport = area_;
+		layerPacket.displayScale = {1.f, 1.f};
+		layerPacket.displayOffset = {0.f, 0.f};
+		layerPacket.transparent = true;
+		layerPacket.mask = -1;
+
+		prepare(layerPacket);
+
+		cullOccluded(layerPacket);
+
+		sortRecords(layerPacket);
+
+		// Anything batched so far belongs to the window
+		flush();
+
+		SDL_Texture *previousTarget_ = outputTarget;
+		SDL_Rect previousArea_ = outputArea;
+
+		outputTarget = renderTexture_.texture;
+		outputArea = area_;
+
+		setRenderTarget(outputTarget);
+
+		setDrawColor(0x00, 0x00, 0x00, 0x00);
+		commandBuffer.clear();
+
+		render(scene_, layerPacket);
+
+		flush();
+
+		outputTarget = previousTarget_;
+		outputArea = previousArea_;
+
+		setRenderTarget(outputTarget);
+
+		layer_.dirty = false;
+	}
+}
+
+}	// namespace Zen
@@ -0,0 +1,127 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include <array>
+
+#include "../core/config.hpp"
+
+namespace Zen {
+
+/**
+ * The number of opaque areas a record is tested against. Only the largest
+ * ones are kept.
+ */
+static const std::size_t MAX_OCCLUDERS = 8;
+
+/**
+ * How far from axis-aligned the corners of an opaque quad can be, in pixels.
+ */
+static const float ALIGNMENT_TOLERANCE = 0.01f;
+
+/**
+ * An area fully covered by an opaque record.
+ */
+struct Occluder
+{
+	float left = 0.f, top = 0.f, right = 0.f, bottom = 0.f;
+
+	float area = 0.f;
+};
+
+void Renderer::cullOccluded (RenderPacket& packet_)
+{
+	if (!config->overdrawCulling || packet_.skip || packet_.count < 2)
+		return;
+
+	std::array<Occluder, MAX_OCCLUDERS> occluders_;
+	std::size_t occluderCount_ = 0;
+
+	// From the last record drawn to the first, as only the records drawn
+	// after one can cover it
+	for (std::size_t i_ = packet_.count; i_-- > 0;)
+	{
+		if (packet_.kinds[i_] != RENDER_RECORD::SPRITE || packet_.culled[i_])
+			continue;
+
+		const SDL_FPoint *quad_ = &packet_.quads[i_ * 4];
+
+		std::array<float, 4> xs_ {quad_[0].x, quad_[1].x, quad_[2].x, quad_[3].x};
+		std::array<float, 4> ys_ {quad_[0].y, quad_[1].y, quad_[2].y, quad_[3].y};
+
+		std::sort(xs_.begin(), xs_.end());
+		std::sort(ys_.begin(), ys_.end());
+
+		bool covered_ = false;
+
+		for (std::size_t k_ = 0; k_ < occluderCount_; k_++)
+		{
+			const auto& occluder_ = occluders_[k_];
+
+			if (xs_[0] >= occluder_.left && xs_[3] <= occluder_.right &&
+				ys_[0] >= occluder_.top && ys_[3] <= occluder_.bottom)
+			{
+				covered_ = true;
+				break;
+			}
+		}
+
+		if (covered_)
+		{
+			packet_.culled[i_] = 1;
+
+			occludedDraws++;
+			occludedPixels += static_cast<std::size_t>(
+					(xs_[3] - xs_[0]) * (ys_[3] - ys_[0]));
+
+			continue;
+		}
+
+		// Only an unmasked, fully opaque record replaces what is behind it
+		const auto& alphas_ = packet_.alphas[i_];
+
+		if (!packet_.opaque[i_] || packet_.masks[i_] >= 0 ||
+			alphas_[0] < 1.f || alphas_[1] < 1.f || alphas_[2] < 1.f || alphas_[3] < 1.f ||
+			(packet_.blendModes[i_] != SDL_BLENDMODE_BLEND &&
+			 packet_.blendModes[i_] != SDL_BLENDMODE_NONE))
+			continue;
+
+		// Unrotated, the corners share two x and two y coordinates
+		if (xs_[1] - xs_[0] > ALIGNMENT_TOLERANCE || xs_[3] - xs_[2] > ALIGNMENT_TOLERANCE ||
+			ys_[1] - ys_[0] > ALIGNMENT_TOLERANCE || ys_[3] - ys_[2] > ALIGNMENT_TOLERANCE)
+			continue;
+
+		// The inner corners, in case the quad is slightly off
+		Occluder occluder_;
+		occluder_.left = xs_[1];
+		occluder_.right = xs_[2];
+		occluder_.top = ys_[1];
+		occluder_.bottom = ys_[2];
+		occluder_.area = (occluder_.right - occluder_.left) * (occluder_.bottom - occluder_.top);
+
+		if (occluder_.area <= 0.f)
+			continue;
+
+		if (occluderCount_ < MAX_OCCLUDERS)
+		{
+			occluders_[occluderCount_++] = occluder_;
+			continue;
+		}
+
+		// Replace the smallest area, if this one is larger
+		auto smallest_ = std::min_element(occluders_.begin(), occluders_.end(),
+				[] (const Occluder& a_, const Occluder& b_) {
+					return a_.area < b_.area;
+				});
+
+		if (smallest_->area < occluder_.area)
+			*smallest_ = occluder_;
+	}
+}
+
+}	// namespace Zen
@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include <exception>
+
+#include "../window/window.hpp"
+
+namespace Zen {
+
+extern Window g_window;
+
+void Renderer::invoke (const std::function<void()>& task_)
+{
+	if (!pipelined || std::this_thread::get_id() == mainThread)
+	{
+		task_();
+		return;
+	}
+
+	bool done_ = false;
+	std::exception_ptr error_;
+
+	{
+		std::lock_guard<std::mutex> lock_(taskMutex);
+
+		mainTasks.emplace_back([this, &task_, &done_, &error_] () {
+			try
+			{
+				task_();
+			}
+			catch (...)
+			{
+				error_ = std::current_exception();
+			}
+
+			std::lock_guard<std::mutex> lock_(taskMutex);
+			done_ = true;
+		});
+	}
+
+	taskCondition.notify_all();
+
+	std::unique_lock<std::mutex> lock_(taskMutex);
+	taskCondition.wait(lock_, [&done_] { return done_; });
+	lock_.unlock();
+
+	if (error_)
+		std::rethrow_exception(error_);
+}
+
+void Renderer::overlap (const std::function<void()>& work_)
+{
+	if (!pipelined)
+	{
+		work_();
+		return;
+	}
+
+	std::exception_ptr error_;
+
+	{
+		std::lock_guard<std::mutex> lock_(taskMutex);
+		workDone = false;
+	}
+
+	pipelineWorker.enqueue([this, &work_, &error_] () {
+		try
+		{
+			work_();
+		}
+		catch (...)
+		{
+			error_ = std::current_exception();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock_(taskMutex);
+			workDone = true;
+		}
+
+		taskCondition.notify_all();
+	});
+
+	// The previous frame only reads its own commands
+	submitFrame();
+
+	// Run what the update needs from the main thread until it is done
+	std::unique_lock<std::mutex> lock_(taskMutex);
+
+	while (true)
+	{
+		taskCondition.wait(lock_, [this] {
+			return workDone || !mainTasks.empty();
+		});
+
+		while (!mainTasks.empty())
+		{
+			auto task_ = std::move(mainTasks.front());
+			mainTasks.pop_front();
+
+			lock_.unlock();
+			task_();
+			taskCondition.notify_all();
+			lock_.lock();
+		}
+
+		if (workDone)
+			break;
+	}
+
+	lock_.unlock();
+
+	if (error_)
+		std::rethrow_exception(error_);
+}
+
+void Renderer::submitFrame ()
+{
+	if (!pendingFrame)
+		return;
+
+	pendingFrame = false;
+
+	submitBuffer.execute();
+	submitBuffer.reset();
+
+	if (submit)
+		SDL_RenderPresent(g_window.renderer);
+}
+
+}	// namespace Zen
@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include "../systems/transform_matrix_batch.hpp"
+
+namespace Zen {
+
+/**
+ * Computes the matrices, window space quads and culling of a range of
+ * records, with the batch transform functions.
+ *
+ * Only the given range of the output vectors is written, so disjoint ranges
+ * can be prepared by different threads at the same time.
+ *
+ * @since 0.0.0
+ *
+ * @param packet_ The render packet to prepare.
+ * @param begin_ The first record to prepare.
+ * @param end_ One past the last record to prepare.
+ */
+static void PrepareRecords (RenderPacket& packet_, std::size_t begin_, std::size_t end_)
+{
+	if (begin_ >= end_)
+		return;
+
+	ApplyITRS(&packet_.matrices,
+			packet_.translateX.data(), packet_.translateY.data(),
+			packet_.rotation.data(),
+			packet_.scaleX.data(), packet_.scaleY.data(),
+			begin_, end_);
+
+	// Apply the views to runs of records sharing the same one, which usually
+	// is the camera for the whole range
+	std::size_t run_ = begin_;
+	for (std::size_t i_ = begin_ + 1; i_ <= end_; i_++)
+	{
+		if (i_ < end_ && packet_.views[i_] == packet_.views[run_])
+			continue;
+
+		Multiply(packet_.viewMatrices[packet_.views[run_]], &packet_.matrices, run_, i_);
+		run_ = i_;
+	}
+
+	TransformQuads(packet_.matrices, packet_.sizes.data(),
+			packet_.displayScale, packet_.displayOffset,
+			packet_.quads.data(), begin_, end_);
+
+	if (!packet_.cull)
+		return;
+
+	float left_ = packet_.viewport.x;
+	float top_ = packet_.viewport.y;
+	float right_ = left_ + packet_.viewport.w;
+	float bottom_ = top_ + packet_.viewport.h;
+
+	// Masks are never culled, they cover whatever they are masking
+	for (std::size_t i_ = begin_; i_ < end_ && i_ < packet_.count; i_++)
+	{
+		if (packet_.kinds[i_] != RENDER_RECORD::SPRITE)
+			continue;
+
+		const SDL_FPoint *quad_ = &packet_.quads[i_ * 4];
+
+		float minX_ = std::min({quad_[0].x, quad_[1].x, quad_[2].x, quad_[3].x});
+		float maxX_ = std::max({quad_[0].x, quad_[1].x, quad_[2].x, quad_[3].x});
+		float minY_ = std::min({quad_[0].y, quad_[1].y, quad_[2].y, quad_[3].y});
+		float maxY_ = std::max({quad_[0].y, quad_[1].y, quad_[2].y, quad_[3].y});
+
+		packet_.culled[i_] = maxX_ <= left_ || minX_ >= right_ ||
+			maxY_ <= top_ || minY_ >= bottom_;
+	}
+}
+
+void Renderer::prepare (RenderPacket& packet_)
+{
+	if (packet_.skip)
+		return;
+
+	if (!workers.size())
+	{
+		PrepareRecords(packet_, 0, packet_.size());
+		return;
+	}
+
+	// Each chunk is a contiguous range of records, written in place, so the
+	// records stay in depth order without any merge
+	workers.parallelFor(
+			packet_.size(),
+			[&packet_] (std::size_t, std::size_t begin_, std::size_t end_) {
+				PrepareRecords(packet_, begin_, end_);
+			},
+			prepareChunkSize
+			);
+}
+
+}	// namespace Zen
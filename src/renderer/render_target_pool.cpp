@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "render_target_pool.hpp"
+
+#include <algorithm>
+
+#include "../utils/messages.hpp"
+
+namespace Zen {
+
+void RenderTargetPool::onDestroy (std::function<void(SDL_Texture*)> callback_)
+{
+	destroyCallback = callback_;
+}
+
+SDL_Texture* RenderTargetPool::acquire (
+		SDL_Renderer *renderer_,
+		int width_,
+		int height_,
+		Uint32 format_)
+{
+	width_ = std::max(1, width_);
+	height_ = std::max(1, height_);
+
+	// The smallest free target large enough
+	Target *best_ = nullptr;
+
+	for (auto& target_ : targets)
+	{
+		if (target_.used || target_.format != format_ ||
+			target_.width < width_ || target_.height < height_)
+			continue;
+
+		if (!best_ || target_.width * target_.height < best_->width * best_->height)
+			best_ = &target_;
+	}
+
+	if (best_)
+	{
+		best_->used = true;
+		return best_->texture;
+	}
+
+	Target target_;
+	target_.width = (width_ + GRANULARITY - 1) / GRANULARITY * GRANULARITY;
+	target_.height = (height_ + GRANULARITY - 1) / GRANULARITY * GRANULARITY;
+	target_.format = format_;
+	target_.used = true;
+
+	target_.texture = SDL_CreateTexture(
+			renderer_,
+			format_,
+			SDL_TEXTUREACCESS_TARGET,
+			target_.width,
+			target_.height
+			);
+
+	if (!target_.texture)
+	{
+		MessageError("Unable to create a render target: ", SDL_GetError());
+		return nullptr;
+	}
+
+	targets.emplace_back(target_);
+
+	return target_.texture;
+}
+
+void RenderTargetPool::release (SDL_Texture *texture_)
+{
+	for (auto& target_ : targets)
+	{
+		if (target_.texture == texture_)
+		{
+			target_.used = false;
+			target_.released = SDL_GetTicks();
+
+			return;
+		}
+	}
+}
+
+void RenderTargetPool::trim (Uint32 idleTime_)
+{
+	Uint32 now_ = SDL_GetTicks();
+
+	for (std::size_t i_ = targets.size(); i_-- > 0;)
+	{
+		if (!targets[i_].used && now_ - targets[i_].released >= idleTime_)
+			destroy(i_);
+	}
+}
+
+void RenderTargetPool::clear ()
+{
+	for (std::size_t i_ = targets.size(); i_-- > 0;)
+	{
+		if (!targets[i_].used)
+			destroy(i_);
+	}
+}
+
+std::size_t RenderTargetPool::size () const
+{
+	return targets.size();
+}
+
+void RenderTargetPool::destroy (std::size_t index_)
+{
+	SDL_Texture *texture_ = targets[index_].texture;
+
+	targets[index_] = targets.back();
+	targets.pop_back();
+
+	if (destroyCallback)
+		destroyCallback(texture_);
+	else
+		SDL_DestroyTexture(texture_);
+}
+
+}	// namespace Zen
@@ -0,0 +1,148 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_RENDERTARGETPOOL_HPP
+#define ZEN_RENDERER_RENDERTARGETPOOL_HPP
+
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace Zen {
+
+/**
+ * Render target textures shared by every pass needing a temporary one.
+ *
+ * A target is only created the first time a pass asks for one that no free
+ * target can serve, and goes back to the pool once the pass is done. Any
+ * free target at least as large as requested, with the same format, is
+ * reused, so callers must address it with explicit rectangles. The targets
+ * left unused for a while are destroyed by `trim`.
+ *
+ * @class RenderTargetPool
+ * @since 0.0.0
+ */
+class RenderTargetPool
+{
+public:
+	/**
+	 * Sets the function destroying the targets, in place of
+	 * `SDL_DestroyTexture`, so that the state tracked for them can be
+	 * forgotten.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param callback_ The function to call with the texture.
+	 */
+	void onDestroy (std::function<void(SDL_Texture*)> callback_);
+
+	/**
+	 * Takes a free target covering the given size out of the pool, creating
+	 * one if there is none.
+	 *
+	 * The contents of the target are undefined.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param renderer_ The SDL renderer owning the targets.
+	 * @param width_ The smallest width needed, in pixels.
+	 * @param height_ The smallest height needed, in pixels.
+	 * @param format_ The pixel format of the target.
+	 *
+	 * @return The target, or `nullptr` if it couldn't be created.
+	 */
+	SDL_Texture* acquire (
+			SDL_Renderer *renderer_,
+			int width_,
+			int height_,
+			Uint32 format_ = SDL_PIXELFORMAT_RGBA8888);
+
+	/**
+	 * Gives a target back to the pool.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture_ A target returned by `acquire`.
+	 */
+	void release (SDL_Texture *texture_);
+
+	/**
+	 * Destroys the free targets unused for some time.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param idleTime_ How long a target must have been free, in
+	 * milliseconds.
+	 */
+	void trim (Uint32 idleTime_);
+
+	/**
+	 * Destroys every free target.
+	 *
+	 * @since 0.0.0
+	 */
+	void clear ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The number of targets alive, free or not.
+	 */
+	std::size_t size () const;
+
+private:
+	/**
+	 * @since 0.0.0
+	 */
+	struct Target
+	{
+		SDL_Texture *texture = nullptr;
+
+		int width = 0;
+
+		int height = 0;
+
+		Uint32 format = SDL_PIXELFORMAT_UNKNOWN;
+
+		bool used = false;
+
+		/**
+		 * When the target was last released, in milliseconds.
+		 */
+		Uint32 released = 0;
+	};
+
+	/**
+	 * Destroys the target at the given index.
+	 *
+	 * @since 0.0.0
+	 */
+	void destroy (std::size_t index_);
+
+	/**
+	 * Sizes are rounded up to a multiple of this, so that a window resized a
+	 * few pixels at a time keeps reusing the same targets.
+	 *
+	 * @since 0.0.0
+	 */
+	static const int GRANULARITY = 64;
+
+	/**
+	 * @since 0.0.0
+	 */
+	std::vector<Target> targets;
+
+	/**
+	 * @since 0.0.0
+	 */
+	std::function<void(SDL_Texture*)> destroyCallback;
+};
+
+}	// namespace Zen
+
+#endif
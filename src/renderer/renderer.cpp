@@ -7,6 +7,8 @@
 
 #include "renderer.hpp"
 
+#include <algorithm>
+
 #include "../window/window.hpp"
 #include "../scale/scale_manager.hpp"
 #include "../scene/scene.hpp"
@@ -41,6 +43,8 @@
 #include "../texture/systems/frame.hpp"
 #include "../texture/components/frame.hpp"
 #include "../texture/components/source.hpp"
+#include "../components/tint.hpp"
+#include "../components/alpha.hpp"
 #include "../cameras/2d/systems/camera.hpp"
 #include "../text/text_manager.hpp"
 
@@ -53,11 +57,13 @@ extern TextManager g_text;
 
 Renderer::~Renderer ()
 {
+	// Finish the pending snapshots while their buffers are still alive
+	snapshotWorker.stop();
+
+	capture.stop();
+
 	/*
 	 * Destroying the renderer is enough to clean all textures
-	if (snapshotState.surface)
-		SDL_FreeSurface(snapshotState.surface);
-
 	if (maskBuffer)
 		SDL_DestroyTexture(maskBuffer);
 
@@ -75,6 +81,20 @@ void Renderer::start (GameConfig *cfg_)
 
 	backgroundColor = config->backgroundColor;
 
+	submit = config->renderBackend != RENDER_BACKEND::NONE;
+
+	// Pipelined frames are always deferred, to be submitted later
+	pipelined = config->pipelinedRendering;
+	mainThread = std::this_thread::get_id();
+
+	commandBuffer.setRenderer(g_window.renderer);
+	commandBuffer.setRecording(config->deferredRendering || pipelined);
+	commandBuffer.setDrawing(submit);
+
+	submitBuffer.setRenderer(g_window.renderer);
+	submitBuffer.setRecording(commandBuffer.isRecording());
+	submitBuffer.setDrawing(submit);
+
 	g_scale.on("resize", &Renderer::onResize, this);
 
 	// Set the mask texture blend mode
@@ -90,6 +110,40 @@ void Renderer::start (GameConfig *cfg_)
 	// Create the supported blend modes
 	createBlendModes();
 
+	// Sync the tracked state with the SDL renderer
+	resetState();
+
+	// Spawn the workers preparing the render packets
+	if (config->parallelRender)
+		workers.start(config->renderThreads);
+
+	// Spawn the worker encoding the snapshots
+	snapshotWorker.start(1);
+
+	// Spawn the worker updating the scenes
+	if (pipelined)
+		pipelineWorker.start(1);
+
+	// The tracked state of a destroyed render target is stale, and the
+	// recorded commands may still use it
+	renderTargets.onDestroy([this] (SDL_Texture *texture_) {
+		destroyTexture(texture_);
+	});
+
+	// Every quad is made of two triangles: top-left, top-right, bottom-right
+	// and bottom-right, bottom-left, top-left
+	batchVertices.reserve(batchSize * 4);
+	batchIndices.resize(batchSize * 6);
+	for (int i_ = 0; i_ < batchSize; i_++)
+	{
+		batchIndices[i_ * 6 + 0] = i_ * 4 + 0;
+		batchIndices[i_ * 6 + 1] = i_ * 4 + 1;
+		batchIndices[i_ * 6 + 2] = i_ * 4 + 2;
+		batchIndices[i_ * 6 + 3] = i_ * 4 + 2;
+		batchIndices[i_ * 6 + 4] = i_ * 4 + 3;
+		batchIndices[i_ * 6 + 5] = i_ * 4 + 0;
+	}
+
 	resize(g_window.width(), g_window.height());
 }
 
@@ -105,790 +159,542 @@ void Renderer::resize (int width_, int height_)
 	width = width_;
 	height = height_;
 
-	// Free the mask buffer
-	if (maskBuffer)
-		SDL_DestroyTexture(maskBuffer);
-
-	// Reset it to the same size as the renderer
-	maskBuffer = SDL_CreateTexture(
-			g_window.renderer,
-			SDL_PIXELFORMAT_RGBA8888,
-			SDL_TEXTUREACCESS_TARGET,
-			width,
-			height
-			);
-
-	// Enable transparency
-	SDL_SetTextureBlendMode(maskBuffer, SDL_BLENDMODE_BLEND);
-
-	// Free the camera buffer
-	if (cameraBuffer)
-		SDL_DestroyTexture(cameraBuffer);
-
-	// Reset it to the same size as the renderer
-	cameraBuffer = SDL_CreateTexture(
-			g_window.renderer,
-			SDL_PIXELFORMAT_RGBA8888,
-			SDL_TEXTUREACCESS_TARGET,
-			width,
-			height
-			);
-
-	// Enable transparency
-	SDL_SetTextureBlendMode(maskBuffer, SDL_BLENDMODE_BLEND);
+	MarkFrameDirty();
 
-	// Free the mask texture
-	if (maskTexture)
-		SDL_DestroyTexture(maskTexture);
+	// The pooled render targets of the previous size are freed once the
+	// size stops changing
+	resizeTime = SDL_GetTicks();
 
-	// Reset it to the same size as the renderer
-	maskTexture = SDL_CreateTexture(
-			g_window.renderer,
-			SDL_PIXELFORMAT_RGBA8888,
-			SDL_TEXTUREACCESS_TARGET,
-			width,
-			height
-			);
-
-	// Set the mask texture's blend mode
-	SDL_SetTextureBlendMode(maskTexture, maskBlendMode);
+	// The viewports of the cached cameras may have moved
+	auto caches_ = g_registry.view<Components::RenderCache>();
+	for (auto entity_ : caches_)
+		caches_.get<Components::RenderCache>(entity_).valid = false;
 }
 
 void Renderer::preRender ()
 {
+	updateFrameTarget();
+
 	if (config->clearBeforeRender)
 	{
-		SDL_SetRenderDrawColor(
-				g_window.renderer,
+		setDrawColor(
 				backgroundColor.red,
 				backgroundColor.green,
 				backgroundColor.blue,
 				0xff);
-		SDL_RenderClear(g_window.renderer);
+		commandBuffer.clear();
 	}
 
-	drawCount = 0;
-
-	emit("pre-render");
-}
-
-void Renderer::render (
-		Scene& scene_,
-		std::vector<Entity> children_,
-		Entity camera_)
-{
-	emit("render");
-
-	int offsetX_ = g_scale.displayOffset.x;
-	int offsetY_ = g_scale.displayOffset.y;
-	double scaleX_ = g_scale.displayScale.x;
-	double scaleY_ = g_scale.displayScale.y;
-
-	SDL_Rect c_;
-	c_.x = GetX(camera_);
-	c_.y = GetY(camera_);
-	c_.w = GetWidth(camera_);
-	c_.h = GetHeight(camera_);
-
-	if (GetViewport(camera_) || g_scale.scaleMode != SCALE_MODE::RESIZE)
+	// Everything is drawn at the internal resolution, then upscaled once
+	if (frameTarget)
 	{
-		// Skip rendering this camera if its viewport is outside the window
-		if (c_.x > width || c_.y > height || c_.x < -c_.w || c_.y < -c_.h)
-			return;
+		outputTarget = frameTarget;
+		outputArea = {0, 0, frameWidth, frameHeight};
 
-		// Clip the viewport if it goes outside the left side of the window
-		if (c_.x < 0)
-		{
-			c_.w += c_.x;
-			c_.x = 0;
-		}
+		setRenderTarget(frameTarget);
 
-		// Clip the viewport if it goes outside the right side of the window
-		if ((c_.x + c_.w) > width)
-		{
-			c_.w = width - c_.x;
-		}
-
-		// Clip the viewport if it goes outside the top side of the window
-		if (c_.y < 0)
-		{
-			c_.h += c_.y;
-			c_.y = 0;
-		}
-
-		// Clip the viewport if it goes outside the bottom side of the window
-		if ((c_.y + c_.h) > height)
-		{
-			c_.h = height - c_.y;
-		}
-	}
-
-	c_.x *= scaleX_;
-	c_.y *= scaleY_;
-	c_.w *= scaleX_;
-	c_.h *= scaleY_;
-	c_.x += offsetX_;
-	c_.y += offsetY_;
-
-	// Clip the renderer
-	if (GetViewport(camera_) || g_scale.scaleMode != SCALE_MODE::RESIZE)
-	{
-		SDL_RenderSetClipRect(g_window.renderer, &c_);
+		if (config->clearBeforeRender)
+			commandBuffer.clear();
 	}
 
-	if (GetMask(camera_) != entt::null)
-		preRenderMask(entt::null);
+	frameCount++;
 
-	// Camera's background color if not transparent
-	if (!IsTransparent(camera_)) {
-		SDL_SetRenderDrawBlendMode(g_window.renderer, SDL_BLENDMODE_BLEND);
-
-		auto bgc = GetBackgroundColor(camera_);
-
-		SDL_SetRenderDrawColor(
-			g_window.renderer,
-			bgc.red,
-			bgc.green,
-			bgc.blue,
-			bgc.alpha * GetAlpha(camera_)
-		);
+	drawCount = 0;
+	stateChanges = 0;
+	elidedStateChanges = 0;
+	textureSwitches = 0;
+	savedTextureSwitches = 0;
+	occludedDraws = 0;
+	occludedPixels = 0;
 
-		SDL_RenderFillRect(g_window.renderer, &c_);
+	emit("pre-render");
+}
 
-		// Reset draw blend mode
-		SDL_SetRenderDrawBlendMode(g_window.renderer, SDL_BLENDMODE_NONE);
-	}
+/**
+ * Computes the pixels covered by the quad of a record, and intersects them
+ * with an area.
+ *
+ * The quads of rectangle masks are rounded to the nearest pixels, like the
+ * edges of a drawn quad, the others are rounded outward.
+ *
+ * @param packet_ The prepared render packet.
+ * @param index_ The index of the record.
+ * @param area_ The area to intersect, overwritten by the result.
+ *
+ * @return `false` if the intersection is empty.
+ */
+static bool ClipToRecord (const RenderPacket& packet_, std::size_t index_, SDL_Rect *area_)
+{
+	const SDL_FPoint *quad_ = &packet_.quads[index_ * 4];
 
-	drawCount += children_.size();
+	float minX_ = quad_[0].x, maxX_ = quad_[0].x;
+	float minY_ = quad_[0].y, maxY_ = quad_[0].y;
 
-	// Render the GameObject
-	for (auto& child_ : children_)
+	for (int i_ = 1; i_ < 4; i_++)
 	{
-		// !!! TEXT LAB !!!
-		if (IsText(child_)) {
-			g_text.render(child_);
-			continue;
-		}
-		// !!! TEXT LAB !!!
-
-		AddToRenderList(camera_, child_);
-
-		if (child_ != entt::null && GetFrame(child_) != entt::null)
-			batchSprite(child_, GetFrame(child_), camera_, GetParentTransformMatrix(child_));
+		minX_ = std::min(minX_, quad_[i_].x);
+		maxX_ = std::max(maxX_, quad_[i_].x);
+		minY_ = std::min(minY_, quad_[i_].y);
+		maxY_ = std::max(maxY_, quad_[i_].y);
 	}
 
-	//camera_.flashEffect.postRender();
-	//camera_.fadeEffect.postRender();
+	// Keep far away quads in the range of an `int`
+	const float limit_ = 1 << 24;
 
-	SetDirty(camera_, false);
+	minX_ = Math::Clamp(minX_, -limit_, limit_);
+	maxX_ = Math::Clamp(maxX_, -limit_, limit_);
+	minY_ = Math::Clamp(minY_, -limit_, limit_);
+	maxY_ = Math::Clamp(maxY_, -limit_, limit_);
 
-	if (GetMask(camera_) != entt::null)
-		postRenderMask(GetMask(camera_), entt::null, camera_);
+	SDL_Rect bounds_;
 
-	// Remove the viewport if previously set
-	if (GetViewport(camera_))
+	if (packet_.kinds[index_] == RENDER_RECORD::RECT)
 	{
-		SDL_RenderSetClipRect(g_window.renderer, nullptr);
+		bounds_.x = std::lround(minX_);
+		bounds_.y = std::lround(minY_);
+		bounds_.w = std::lround(maxX_) - bounds_.x;
+		bounds_.h = std::lround(maxY_) - bounds_.y;
+	}
+	else
+	{
+		bounds_.x = std::floor(minX_);
+		bounds_.y = std::floor(minY_);
+		bounds_.w = static_cast<int>(std::ceil(maxX_)) - bounds_.x;
+		bounds_.h = static_cast<int>(std::ceil(maxY_)) - bounds_.y;
 	}
-}
 
-void Renderer::postRender ()
-{
-	// Update the screen once every element has been rendered
-	// This will also trigger a delay as the renderer is Vsynced
-	SDL_RenderPresent(g_window.renderer);
+	SDL_Rect result_;
 
-	emit("post-render");
+	if (!SDL_IntersectRect(area_, &bounds_, &result_))
+		return false;
 
-	if (snapshotState.active)
-	{
-		takeSnapshot();
+	*area_ = result_;
 
-		snapshotState.active = false;
-	}
+	return true;
 }
 
-Renderer& Renderer::snapshot (std::string path_, std::function<void(SDL_Surface*)> callback_)
+void Renderer::render (Scene& scene_, const RenderPacket& packet_)
 {
-	return snapshotArea(0, 0, g_window.width(), g_window.height(), path_, callback_);
-}
-
-Renderer& Renderer::snapshotArea (
-		int x_,
-		int y_,
-		int width_,
-		int height_,
-		std::string path_,
-		std::function<void(SDL_Surface*)> callback_)
-{
-	snapshotState.callback = callback_;
+	emit("render");
 
-	snapshotState.callbackPixel = nullptr;
+	if (packet_.skip)
+		return;
 
-	snapshotState.path = path_;
+	// The area of the render target the Camera draws to. The packets of the
+	// window are in display coordinates, not in game coordinates
+	SDL_Rect area_ = outputTarget ? outputArea : SDL_Rect {0, 0, g_window.width(), g_window.height()};
 
-	snapshotState.getPixel = false;
+	if (packet_.clip && !SDL_IntersectRect(&packet_.viewport, &area_, &area_))
+		return;
 
-	snapshotState.x = Math::Clamp(x_, 0, g_window.width());
+	// Nothing outside of the bounds of the Camera mask is visible
+	if (packet_.mask >= 0 && !ClipToRecord(packet_, packet_.mask, &area_))
+		return;
 
-	snapshotState.y = Math::Clamp(y_, 0, g_window.height());
+	// Clip the renderer. A rectangle mask is nothing more than that
+	bool clip_ = packet_.clip || packet_.mask >= 0;
+	bool cameraMask_ = packet_.mask >= 0 && packet_.kinds[packet_.mask] != RENDER_RECORD::RECT;
 
-	snapshotState.width = Math::Clamp(
-			width_,
-			0,
-			g_window.width() - snapshotState.x);
+	if (clip_)
+		setClipRect(&area_);
 
-	snapshotState.height = Math::Clamp(
-			height_,
-			0,
-			g_window.height() - snapshotState.y);
+	// Without a buffer, the Camera is drawn unmasked
+	if (cameraMask_)
+		cameraMask_ = preRenderMask(true, area_);
 
-	snapshotState.active = true;
+	// Camera's background color if not transparent
+	if (!packet_.transparent) {
+		flush();
 
-	return *this;
-}
+		setDrawBlendMode(SDL_BLENDMODE_BLEND);
 
-Renderer& Renderer::snapshotPixel (int x_, int y_, std::function<void(Color)>& callback_)
-{
-	snapshotArea(x_, y_, 1, 1, "", nullptr);
+		setDrawColor(
+			packet_.background.r,
+			packet_.background.g,
+			packet_.background.b,
+			packet_.background.a
+		);
 
-	snapshotState.getPixel = true;
-	snapshotState.callbackPixel = callback_;
+		commandBuffer.fillRect(&packet_.viewport);
+	}
 
-	return *this;
-}
+	// Whether a mask changed the clip rectangle of the Camera
+	bool restoreClip_ = false;
 
-Renderer& Renderer::snapshotPixel (int x_, int y_, std::function<void(Color)>&& callback_)
-{
-	return snapshotPixel(x_, y_, callback_);
-}
+	// The record drawn at a position, which is its index unless sorted
+	auto at_ = [&packet_] (std::size_t position_) {
+		return packet_.order.empty() ? position_ : packet_.order[position_];
+	};
 
-void Renderer::takeSnapshot ()
-{
-	if (!snapshotState.active)
-		return;
+	// Render the GameObject
+	for (std::size_t p_ = 0; p_ < packet_.count; p_++)
+	{
+		std::size_t i_ = at_(p_);
+		int mask_ = packet_.masks[i_];
+		bool rectMask_ = mask_ >= 0 && packet_.kinds[mask_] == RENDER_RECORD::RECT;
 
-	if (snapshotState.surface) {
-		SDL_FreeSurface(snapshotState.surface);
-		snapshotState.surface = nullptr;
-	}
+		if (restoreClip_ && !rectMask_)
+		{
+			setClipRect(clip_ ? &area_ : nullptr);
+			restoreClip_ = false;
+		}
 
-	// Get the pixel format of the window
-	SDL_Surface *infoSurface_ = nullptr;
+		// !!! TEXT LAB !!!
+		if (packet_.kinds[i_] == RENDER_RECORD::TEXT) {
+			// Text is drawn directly, draw what came before it first
+			flush();
 
-	infoSurface_ = SDL_GetWindowSurface(g_window.window);
+			g_text.render(packet_.entities[i_]);
+			continue;
+		}
+		// !!! TEXT LAB !!!
 
-	if (!infoSurface_) {
-		MessageError("Failed to create info surface from window: ", SDL_GetError());
-		return;
-	}
+		if (packet_.culled[i_])
+			continue;
 
-	SDL_PixelFormat pixelFormat_ = *infoSurface_->format;
+		if (mask_ < 0)
+		{
+			batchRecord(packet_, i_);
+			continue;
+		}
 
-	SDL_FreeSurface(infoSurface_);
+		// Clip the record, consecutive records clipped to the same rectangle
+		// stay in the same batch
+		if (rectMask_)
+		{
+			SDL_Rect clipRect_ = area_;
 
+			if (ClipToRecord(packet_, mask_, &clipRect_))
+			{
+				setClipRect(&clipRect_);
+				batchRecord(packet_, i_);
 
-	if (snapshotState.getPixel) {
-		// Pixel grab
-		Uint32 pixel_;
-		int pitch_ = 4;
-		SDL_Rect rect_;
-		rect_.x = snapshotState.x;
-		rect_.y = snapshotState.y;
-		rect_.w = 1;
-		rect_.h = 1;
+				restoreClip_ = true;
+			}
 
-		if (SDL_RenderReadPixels(
-					g_window.renderer,
-					&rect_,
-					pixelFormat_.format,
-					&pixel_,
-					pitch_
-					))
-		{
-			MessageError("Failed to read the window pixel data: ", SDL_GetError());
-			return;
+			continue;
 		}
 
-		// Get the color components of the pixel
-		Uint8 r_ = 0, g_ = 0, b_ = 0, a_ = 0;
-		SDL_GetRGBA(pixel_, &pixelFormat_, &r_, &g_, &b_, &a_);
+		// The following records sharing the mask are masked in the same pass
+		std::size_t end_ = p_ + 1;
 
-		// Save the color components to the output color object
-		Color out_;
-		SetTo(&out_, r_, g_, b_, a_);
+		while (end_ < packet_.count && packet_.masks[at_(end_)] == mask_)
+			end_++;
 
-		// Call the callback if one was given
-		if (snapshotState.callbackPixel)
-			snapshotState.callbackPixel(out_);
-	}
-	else
-	{
-		// Area/Full grab
-		bool areaSnapshot = (
-				snapshotState.x != 0 ||
-				snapshotState.y != 0 ||
-				snapshotState.width != g_window.width() ||
-				snapshotState.height != g_window.height()
-				);
+		// Only the area the records cover goes through the buffers
+		SDL_Rect bounds_ {0, 0, 0, 0};
 
-		// Create a blank surface
-		if (areaSnapshot) {
-			snapshotState.surface = SDL_CreateRGBSurface(
-					0,
-					snapshotState.width,
-					snapshotState.height,
-					pixelFormat_.BitsPerPixel,
-					pixelFormat_.Rmask,
-					pixelFormat_.Gmask,
-					pixelFormat_.Bmask,
-					pixelFormat_.Amask
-					);
-		} else {
-			snapshotState.surface = SDL_CreateRGBSurface(
-					0,
-					g_window.width(),
-					g_window.height(),
-					pixelFormat_.BitsPerPixel,
-					pixelFormat_.Rmask,
-					pixelFormat_.Gmask,
-					pixelFormat_.Bmask,
-					pixelFormat_.Amask
-					);
-		}
-		if (!snapshotState.surface) {
-			MessageError("Failed to create an RGB surface: ", SDL_GetError());
-			return;
-		}
+		for (std::size_t j_ = p_; j_ < end_; j_++)
+		{
+			SDL_Rect record_ = area_;
 
-		int readFailed_ = 1;
-
-		// Read the window's pixels
-		if (areaSnapshot) {
-			// Read the rectangle defined in snapshotState
-			SDL_Rect rect_;
-			rect_.x = snapshotState.x;
-			rect_.y = snapshotState.y;
-			rect_.w = snapshotState.width;
-			rect_.h = snapshotState.height;
-
-			MessageNote("area");
-
-			readFailed_ = SDL_RenderReadPixels(
-					g_window.renderer,
-					&rect_,
-					pixelFormat_.format,
-					snapshotState.surface->pixels,
-					snapshotState.surface->pitch);
-		} else {
-			// Read the whole window
-			readFailed_ = SDL_RenderReadPixels(
-					g_window.renderer,
-					nullptr,
-					pixelFormat_.format,
-					snapshotState.surface->pixels,
-					snapshotState.surface->pitch);
+			if (!packet_.culled[at_(j_)] && ClipToRecord(packet_, at_(j_), &record_))
+				SDL_UnionRect(&bounds_, &record_, &bounds_);
 		}
 
-		// Check if the renderer was read normally
-		if (readFailed_) {
-			MessageError("Failed to read the window pixel data: ", SDL_GetError());
-			SDL_FreeSurface(snapshotState.surface);
-			return;
-		}
+		if (!SDL_RectEmpty(&bounds_) && ClipToRecord(packet_, mask_, &bounds_) &&
+			preRenderMask(false, bounds_))
+		{
+
+			for (std::size_t j_ = p_; j_ < end_; j_++)
+				if (!packet_.culled[at_(j_)])
+					batchRecord(packet_, at_(j_));
 
-		// Save an image file if a path is given
-		if (snapshotState.path != "") {
-			saveSnapshot();
+			postRenderMask(packet_, mask_, false, bounds_);
+
+			// Changing the render target may have dropped the clip rectangle
+			restoreClip_ = true;
 		}
 
-		// Call the callback if one was given
-		if (snapshotState.callback)
-			snapshotState.callback(snapshotState.surface);
+		p_ = end_ - 1;
 	}
-}
 
-void Renderer::saveSnapshot ()
-{
-	std::string& path_ = snapshotState.path;
-	std::string extension_ = "";
+	if (restoreClip_)
+		setClipRect(clip_ ? &area_ : nullptr);
 
-	// Figure out the file type
-	for (auto c_ = path_.rbegin(); c_ != path_.rend(); c_++) {
-		if (*c_ == '.')
-		{
-			// We read all the extension's characters
-			break;
-		}
+	//camera_.flashEffect.postRender();
+	//camera_.fadeEffect.postRender();
 
-		extension_.insert(0, 1, *c_);
-	}
+	if (cameraMask_)
+		postRenderMask(packet_, packet_.mask, true, area_);
 
-	if (extension_ == "bmp")
-	{
-		if (SDL_SaveBMP(snapshotState.surface, path_.c_str()))
-			MessageError("Failed to save snapshot in a 'BMP' file: ", SDL_GetError());
-	}
-	else if (extension_ == "png")
-	{
-		if (IMG_SavePNG(snapshotState.surface, path_.c_str()))
-			MessageError("Failed to save snapshot in a 'PNG' file: ", IMG_GetError());
-	}
-	else if (extension_ == "jpg")
-	{
-		if (IMG_SaveJPG(snapshotState.surface, path_.c_str(), 100))
-			MessageError("Failed to save snapshot in a 'JPG' file: ", IMG_GetError());
-	}
-	else if (extension_ == "jpeg")
-	{
-		if (IMG_SaveJPG(snapshotState.surface, path_.c_str(), 100))
-			MessageError("Failed to save snapshot in a 'JPEG' file: ", IMG_GetError());
-	}
-	else
-	{
-		MessageError("File type unsupported! Try something else like 'png' or 'jpg'.");
-	}
+	// Remove the viewport if previously set
+	if (clip_)
+		setClipRect(nullptr);
 }
 
-void Renderer::batchSprite (
-		Entity sprite_,
-		Entity frame_,
-		Entity camera_,
-		Components::TransformMatrix *parentTransformMatrix_)
+void Renderer::postRender ()
 {
-	double alpha_ = GetAlpha(camera_) * GetAlpha(sprite_);
+	// Draw whatever is left in the batch
+	flush();
 
-	if (!alpha_)
-		// Nothing to see, so abort early
-		return;
+	if (frameTarget)
+	{
+		outputTarget = nullptr;
 
-	auto& camMatrix_ = tempMatrix1;
-	auto& spriteMatrix_ = tempMatrix2;
+		setRenderTarget(nullptr);
 
-	Rectangle dd_ = GetFrameDrawImageData(frame_);
+		SDL_Rect area_ {
+			static_cast<int>(std::lround(g_scale.displayOffset.x)),
+			static_cast<int>(std::lround(g_scale.displayOffset.y)),
+			static_cast<int>(std::lround(g_scale.displaySize.width)),
+			static_cast<int>(std::lround(g_scale.displaySize.height))
+		};
 
-	auto cut = GetFrameCut(frame_);
+		commandBuffer.copy(frameTarget, nullptr, &area_);
+	}
 
-	// FIXME Stop cheating and implement correct components to frames
-	auto frameCheat___ = g_registry.get<Components::Frame>(frame_);
+	// A frame still waiting goes first
+	submitFrame();
 
-	double frameX_ = dd_.x;
-	double frameY_ = dd_.y;
-	double frameWidth_;
-	double frameHeight_;
+	// Pipelined, the frame is submitted while the next one is updated,
+	// unless it must be read back now
+	bool pending_ = pipelined && snapshotQueue.empty() &&
+		!capture.isRunning() && commandsPath.empty();
 
-	if (frameCheat___.rotated)
+	if (pending_)
 	{
-		frameWidth_ = cut.height;
-		frameHeight_ = cut.width;
+		std::swap(commandBuffer, submitBuffer);
+		pendingFrame = true;
 	}
 	else
 	{
-		frameWidth_ = cut.width;
-		frameHeight_ = cut.height;
-	}
-
-	// FIXME AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
-	double res_ = 1.0; // frame___.source->resolution;
-
-	double displayOriginX_ = GetDisplayOriginX(sprite_);
-	double displayOriginY_ = GetDisplayOriginY(sprite_);
-
-	double x_ = (-1. * displayOriginX_) + frameCheat___.data.spriteSourceSize.x;
-	double y_ = (-1. * displayOriginY_) + frameCheat___.data.spriteSourceSize.y;
-
-	if (IsCropped(sprite_))
-	{
-		auto crop_ = GetCrop(sprite_);
+		// Run the recorded commands, the frame must be complete to be read
+		commandBuffer.execute();
 
-		if (crop_.flipX != GetFlipX(sprite_) || crop_.flipY != GetFlipY(sprite_))
-			UpdateFrameCropUVs(frame_, &crop_, GetFlipX(sprite_), GetFlipY(sprite_));
-
-		frameWidth_ = crop_.cw;
-		frameHeight_ = crop_.ch;
-
-		frameX_ = crop_.cx;
-		frameY_ = crop_.cy;
-
-		x_ = -displayOriginX_ + crop_.x;
-		y_ = -displayOriginY_ + crop_.y;
-
-		if (GetFlipX(sprite_)) {
-			if (x_ >= 0)
-				x_ = -(x_ + frameWidth_);
-			else
-				x_ = (std::abs(x_) - frameWidth_);
-		}
+		if (!commandsPath.empty())
+		{
+			commandBuffer.save(commandsPath);
+			commandBuffer.setRecording(config->deferredRendering || pipelined);
 
-		if (GetFlipY(sprite_)) {
-			if (y_ >= 0)
-				y_ = -(y_ + frameHeight_);
-			else
-				y_ = (std::abs(y_) - frameHeight_);
+			commandsPath.clear();
 		}
-	}
-
-	bool flipX_ = GetFlipX(sprite_);
-	bool flipY_ = GetFlipY(sprite_);
 
-	if (!frameCheat___.rotated) {
-		ApplyITRS(&spriteMatrix_,
-			GetX(sprite_) + x_, GetY(sprite_) + y_,
-			GetRotation(sprite_),
-			GetScaleX(sprite_), GetScaleY(sprite_)
-		);
-	}
-	else {
-		ApplyITRS(&spriteMatrix_,
-			GetX(sprite_) + x_, GetY(sprite_) + y_ + frameCheat___.height,
-			GetRotation(sprite_) + Math::DegToRad(-90),
-			GetScaleX(sprite_), GetScaleY(sprite_)
-		);
+		commandBuffer.reset();
 	}
 
-	/*
-	LoadIdentity(&spriteMatrix_);
-	Translate(&spriteMatrix_, GetX(sprite_) + x_, GetY(sprite_) + y_);
+	// Report the snapshots finished since the last frame
+	dispatchSnapshots();
 
-	if (frameCheat___.rotated) {
-		Translate(&spriteMatrix_, 0, frameCheat___.height);
-		Rotate(&spriteMatrix_, Math::DegToRad(-90));
-	}
+	// The back buffer is undefined once presented, read it before
+	takeSnapshots();
 
-	Rotate(&spriteMatrix_, GetRotation(sprite_));
-	Scale(&spriteMatrix_, GetScaleX(sprite_), GetScaleY(sprite_));
-	*/
-
-	camMatrix_ = GetTransformMatrix(camera_);
+	capture.grab(g_window.renderer);
 
-	if (parentTransformMatrix_)
-	{
-		// Multiply the camera by the parent matrix
-		MultiplyWithOffset(
-				&camMatrix_,
-				*parentTransformMatrix_,
-				-GetScrollX(camera_) * GetScrollFactorX(sprite_),
-				-GetScrollY(camera_) * GetScrollFactorY(sprite_)
-				);
+	// Free the render targets the masks no longer use, unless the window is
+	// being resized and they may soon be needed again
+	if (SDL_GetTicks() - resizeTime >= config->renderTargetDebounce)
+		renderTargets.trim(config->renderTargetIdleTime);
 
-		// Undo the camera scroll
-		spriteMatrix_.e = GetX(sprite_);
-		spriteMatrix_.f = GetY(sprite_);
-	}
-	else
-	{
-		spriteMatrix_.e -= GetScrollX(camera_) * GetScrollFactorX(sprite_);
-		spriteMatrix_.f -= GetScrollY(camera_) * GetScrollFactorY(sprite_);
-	}
-
-	// Multiply by the Sprite matrix
-	Multiply(&camMatrix_, spriteMatrix_);
+	// Update the screen once every element has been rendered
+	// This will also trigger a delay as the renderer is Vsynced
+	if (submit && !pending_)
+		SDL_RenderPresent(g_window.renderer);
 
-	// Decompose the transform matrix
-	DecomposedMatrix dm_ = DecomposeMatrix(camMatrix_);
+	emit("post-render");
+}
 
-	if (GetMask(sprite_) != entt::null)
-		preRenderMask(sprite_);
+void Renderer::batchRecord (const RenderPacket& packet_, std::size_t index_)
+{
+	const SDL_FPoint *quad_ = &packet_.quads[index_ * 4];
 
-	// Render the texture
-	SDL_Rect source_;
-	source_.x = frameX_;
-	source_.y = frameY_;
-	source_.w = frameWidth_;
-	source_.h = frameHeight_;
+	// Texture coordinates
+	float uv_[4] {
+		packet_.uvs[index_][0],
+		packet_.uvs[index_][1],
+		packet_.uvs[index_][2],
+		packet_.uvs[index_][3]
+	};
 
-	// ScaleManager values
-	Math::Vector2 sScale_ = g_scale.displayScale;
-	Math::Vector2 sOffset_ = g_scale.displayOffset;
+	// Flip
+	if (packet_.flips[index_] & RENDER_FLIP_X)
+		std::swap(uv_[0], uv_[2]);
 
-	SDL_FRect destination_;
+	if (packet_.flips[index_] & RENDER_FLIP_Y)
+		std::swap(uv_[1], uv_[3]);
 
-	// Position
-	destination_.x = dm_.translateX * sScale_.x + sOffset_.x;
-	destination_.y = dm_.translateY * sScale_.y + sOffset_.y;
+	// Tint (Color Modulation) and Alpha (Transparency) of each corner
+	const auto& tints_ = packet_.tints[index_];
+	const auto& alphas_ = packet_.alphas[index_];
 
-	// Scale
-	destination_.w = (frameWidth_ / res_) * dm_.scaleX * sScale_.x;
-	destination_.h = (frameHeight_ / res_) * dm_.scaleY * sScale_.y;
+	SDL_Color colors_[4];
+	for (int i_ = 0; i_ < 4; i_++)
+	{
+		colors_[i_].r = (tints_[i_] >> 16) & 0xff;
+		colors_[i_].g = (tints_[i_] >> 8) & 0xff;
+		colors_[i_].b = tints_[i_] & 0xff;
+		colors_[i_].a = Math::Clamp(alphas_[i_], 0.f, 1.f) * 255;
+	}
+
+	batchQuad(
+			packet_.textures[index_],
+			packet_.blendModes[index_],
+			quad_,
+			uv_,
+			colors_
+			);
+}
 
-	// Rotation
-	double angle_ = Math::RadToDeg(dm_.rotation);
+Renderer& Renderer::saveCommands (std::string path_)
+{
+	commandsPath = path_;
 
-	// Origin (Already taken care of with the transform matrices)
-	// Set explicitly to '0' as the default is the middle of the sprite.
-	SDL_FPoint origin_ {0.f, 0.f};
+	// Record the next frame, it is saved by `postRender`
+	commandBuffer.setRecording(true);
 
-	// Flip
-	SDL_RendererFlip flip_ = SDL_FLIP_NONE;
-	if (flipX_ && flipY_)
-	{
-		flip_ = (SDL_RendererFlip)(SDL_FLIP_VERTICAL | SDL_FLIP_HORIZONTAL);
-	}
-	else if (flipX_)
-	{
-		flip_ = (SDL_RendererFlip)SDL_FLIP_HORIZONTAL;
-	}
-	else if (flipY_)
-	{
-		flip_ = (SDL_RendererFlip)SDL_FLIP_VERTICAL;
-	}
+	return *this;
+}
 
-	// FIXME AAAAAAAAAAAAAAAAAAAAAa
-	auto source___ = g_registry.get<Components::TextureSource>(frameCheat___.source);
+void Renderer::updateFrameTarget ()
+{
+	int width_ = g_scale.renderWidth;
+	int height_ = g_scale.renderHeight;
 
-	// Tint (Color Modulation)
-	if (IsTinted(sprite_))
+	if (frameTarget && (frameWidth != width_ || frameHeight != height_))
 	{
-		Color tint_ =  GetTint(sprite_);
+		destroyTexture(frameTarget);
 
-		SDL_SetTextureColorMod(
-			source___.sdlTexture,
-			tint_.red,
-			tint_.green,
-			tint_.blue
-			);
+		frameTarget = nullptr;
 	}
 
-	// Alpha (Transparency)
-	if (alpha_ < 1.0)
-	{
-		SDL_SetTextureBlendMode(
-			source___.sdlTexture,
-			SDL_BLENDMODE_BLEND
-			);
-		SDL_SetTextureAlphaMod(
-			source___.sdlTexture,
-			alpha_ * 255
-			);
-	}
-
-	// Blending
-	if (GetBlendMode(sprite_) != BLEND_MODE::NORMAL)
-	{
-		SDL_SetTextureBlendMode(
-			source___.sdlTexture,
-			blendModes[GetBlendMode(sprite_)]
-			);
-	}
+	if (frameTarget || width_ <= 0 || height_ <= 0)
+		return;
 
-	SDL_RenderCopyExF(
+	frameTarget = SDL_CreateTexture(
 			g_window.renderer,
-			source___.sdlTexture,
-			&source_,
-			&destination_,
-			angle_,
-			&origin_,
-			flip_
+			SDL_PIXELFORMAT_RGBA8888,
+			SDL_TEXTUREACCESS_TARGET,
+			width_,
+			height_
 			);
 
-	// Clear blending
-	if (GetBlendMode(sprite_) != BLEND_MODE::NORMAL)
+	if (!frameTarget)
 	{
-		SDL_SetTextureBlendMode(
-			source___.sdlTexture,
-			blendModes[BLEND_MODE::NORMAL]
-			);
+		MessageError("Unable to create the internal render target: ", SDL_GetError());
+		return;
 	}
 
-	// Clear alpha from texture
-	if (alpha_ < 1.0)
-	{
-		SDL_SetTextureAlphaMod(
-			source___.sdlTexture,
-			255
-			);
-	}
+	frameWidth = width_;
+	frameHeight = height_;
 
-	// Clear tint from texture
-	if (IsTinted(sprite_))
-	{
-		SDL_SetTextureColorMod(
-			source___.sdlTexture,
-			0xff,
-			0xff,
-			0xff
+	// The frame replaces what is under it
+	setTextureBlendMode(frameTarget, SDL_BLENDMODE_NONE);
+
+	SDL_SetTextureScaleMode(
+			frameTarget,
+			config->internalLinear ? SDL_ScaleModeLinear : SDL_ScaleModeNearest
 			);
-	}
 
-	if (GetMask(sprite_) != entt::null)
-		postRenderMask(GetMask(sprite_), sprite_, camera_);
+	MarkFrameDirty();
 }
 
-void Renderer::preRenderMask (Entity maskedObject_)
+bool Renderer::preRenderMask (bool cameraMask_, const SDL_Rect& bounds_)
 {
-	// Is this a camera mask?
-	if (maskedObject_ != entt::null)
+	SDL_Texture *buffer_ = renderTargets.acquire(
+			g_window.renderer,
+			bounds_.x + bounds_.w,
+			bounds_.y + bounds_.h
+			);
+
+	if (!buffer_)
+		return false;
+
+	// Anything batched so far belongs to the current target
+	flush();
+
+	// Enable transparency
+	setTextureBlendMode(buffer_, SDL_BLENDMODE_BLEND);
+
+	// Is this a Game Object mask?
+	if (!cameraMask_)
 	{
-		SDL_SetRenderTarget(g_window.renderer, cameraBuffer);
+		// Either the output or the buffer of a Camera mask
+		maskOutput = renderTarget;
+
+		cameraBuffer = buffer_;
 	}
 	else
 	{
-		SDL_SetRenderTarget(g_window.renderer, maskBuffer);
+		maskBuffer = buffer_;
 	}
 
-	// Clear _AFTER_ setting the target, to clear the buffer and not the screen
-	SDL_SetRenderDrawColor(g_window.renderer, 0x00, 0x00, 0x00, 0x00);
-	SDL_RenderClear(g_window.renderer);
+	setRenderTarget(buffer_);
+
+	// Clear _AFTER_ setting the target, to clear the buffer and not the
+	// screen. Only the area that is composited back needs it
+	setDrawBlendMode(SDL_BLENDMODE_NONE);
+	setDrawColor(0x00, 0x00, 0x00, 0x00);
+	commandBuffer.fillRect(&bounds_);
+
+	return true;
 }
 
 void Renderer::postRenderMask (
-		Entity maskObject_,
-		Entity maskedObject_,
-		Entity camera_)
+		const RenderPacket& packet_,
+		int maskIndex_,
+		bool cameraMask_,
+		const SDL_Rect& bounds_)
 {
+	// Draw the masked object(s) to the current buffer
+	flush();
+
 	// Save the target buffer
-	SDL_Texture *currentTarget_ = SDL_GetRenderTarget(g_window.renderer);
+	SDL_Texture *currentTarget_ = renderTarget;
 
-	// Set the mask texture as the new render target
-	SDL_SetRenderTarget(g_window.renderer, maskTexture);
+	maskTexture = renderTargets.acquire(
+			g_window.renderer,
+			bounds_.x + bounds_.w,
+			bounds_.y + bounds_.h
+			);
 
-	// Clear the mask texture
-	SDL_SetRenderDrawColor(g_window.renderer, 0x00, 0x00, 0x00, 0x00);
-	SDL_RenderClear(g_window.renderer);
+	if (maskTexture)
+	{
+		// Set the mask texture's blend mode
+		setTextureBlendMode(maskTexture, maskBlendMode);
 
-	// Draw the mask GameObject
-	AddToRenderList(camera_, maskObject_);
-	batchSprite(maskObject_, GetFrame(maskObject_), camera_, GetParentTransformMatrix(maskObject_));
+		// Set the mask texture as the new render target
+		setRenderTarget(maskTexture);
 
-	// Reset the target to the buffer
-	SDL_SetRenderTarget(g_window.renderer, currentTarget_);
+		// Clear the mask texture
+		setDrawBlendMode(SDL_BLENDMODE_NONE);
+		setDrawColor(0x00, 0x00, 0x00, 0x00);
+		commandBuffer.fillRect(&bounds_);
 
-	// Render the mask on the buffer
-	SDL_RenderCopy(
-			g_window.renderer,
-			maskTexture,
-			nullptr,	// Render the whole texture
-			nullptr		// Render to the entire target
-			);
+		// Draw the mask GameObject
+		batchRecord(packet_, maskIndex_);
 
-	// Is this a camera mask?
-	if (maskedObject_ != entt::null)
-	{
-		// Reset the rendering target
-		SDL_SetRenderTarget(g_window.renderer, nullptr);
-
-		SDL_RenderCopy(
-				g_window.renderer,
-				cameraBuffer,
-				nullptr,	// Render the whole texture
-				nullptr		// Render to the entire target
+		flush();
+
+		// Reset the target to the buffer
+		setRenderTarget(currentTarget_);
+
+		// Render the mask on the buffer. The buffers are at least as large as
+		// the area, and use the coordinates of the render target
+		commandBuffer.copy(
+				maskTexture,
+				&bounds_,
+				&bounds_
 				);
+
+		renderTargets.release(maskTexture);
+		maskTexture = nullptr;
 	}
+
+	// Render the result back where the masked records belong
+	setRenderTarget(cameraMask_ ? outputTarget : maskOutput);
+
+	commandBuffer.copy(
+			currentTarget_,
+			&bounds_,
+			&bounds_
+			);
+
+	renderTargets.release(currentTarget_);
+
+	if (cameraMask_)
+		maskBuffer = nullptr;
 	else
-	{
-		// Is a camera mask active? If so, set it back to be the rendering target
-		if (GetMask(camera_) != entt::null)
-			SDL_SetRenderTarget(g_window.renderer, cameraBuffer);
-		else
-			SDL_SetRenderTarget(g_window.renderer, nullptr);
-
-		SDL_RenderCopy(
-				g_window.renderer,
-				maskBuffer,
-				nullptr,	// Render the whole texture
-				nullptr		// Render to the entire target
-				);
-	}
+		cameraBuffer = nullptr;
 }
 
 }	// namespace Zen
@@ -9,8 +9,15 @@
 #define ZEN_RENDERER_HPP
 
 #include <SDL2/SDL.h>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <cmath>
 #include <algorithm>
@@ -20,9 +27,17 @@
 #include "../ecs/entity.hpp"
 #include "../event/event_emitter.hpp"
 #include "../math/types/vector2.hpp"
+#include "../geom/types/rectangle.hpp"
 #include "../display/types/color.hpp"
 #include "../structs/types/size.hpp"
 #include "../components/transform_matrix.hpp"
+#include "../components/render_cache.hpp"
+#include "types/render_packet.hpp"
+#include "types/capture_config.hpp"
+#include "frame_capture.hpp"
+#include "render_target_pool.hpp"
+#include "command_buffer.hpp"
+#include "../core/thread_pool.hpp"
 
 #include "../scene/scene.fwd.hpp"
 #include "../core/config.fwd.hpp"
@@ -41,9 +56,6 @@ namespace Zen {
  * or `png` if only directories are given.
  * @property callback The function to call once the snapshot is created.
  * @property callbackPixel The function to call once a pixel snapshot is created.
- * @property surface A pointer to the surface the snapshot was saved in.
- * @property active If set to `true`, a snapshot will be taken after the current
- * frame is fully rendered. It will then be set back to `false`;
  */
 struct SnapshotState
 {
@@ -62,16 +74,67 @@ struct SnapshotState
 	std::function<void(SDL_Surface*)> callback = nullptr;
 
 	std::function<void(Color)> callbackPixel = nullptr;
+};
 
-	/**
-	 * An internal surface pointer that keeps that last snapshot taken, or has
-	 * `nullptr` if no snapshot has been taken since the creation of this renderer.
-	 *
-	 * @since 0.0.0
-	 */
-	SDL_Surface *surface = nullptr;
+/**
+ * The outcome of a snapshot, reported by the `snapshot` event of the
+ * Renderer.
+ *
+ * @since 0.0.0
+ *
+ * @property path The file the snapshot was saved to, empty if none was given.
+ * @property success Whether the snapshot was read and saved.
+ */
+struct SnapshotResult
+{
+	std::string path = "";
+
+	bool success = false;
+};
+
+/**
+ * The last state applied to an SDL texture through the Renderer.
+ *
+ * @since 0.0.0
+ *
+ * @property color The color modulation of the texture. The alpha channel is
+ * the alpha modulation.
+ * @property blendMode The blend mode of the texture.
+ */
+struct TextureState
+{
+	SDL_Color color {0xff, 0xff, 0xff, 0xff};
+
+	SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+};
+
+/**
+ * Consecutive sprites of the same texture and blend mode, drawn one after
+ * the other once sorted.
+ *
+ * @since 0.0.0
+ *
+ * @property texture The texture of the sprites.
+ * @property blendMode The blend mode of the sprites.
+ * @property left The left of the area covered by the sprites, in the
+ * coordinates of their quads.
+ * @property top The top of that area.
+ * @property right The right of that area.
+ * @property bottom The bottom of that area.
+ * @property first The index of the first record of the group.
+ * @property last The index of the last record of the group.
+ */
+struct RecordGroup
+{
+	SDL_Texture *texture = nullptr;
+
+	SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+
+	float left = 0.f, top = 0.f, right = 0.f, bottom = 0.f;
 
-	bool active = false;
+	std::size_t first = 0;
+
+	std::size_t last = 0;
 };
 
 class Renderer : public EventEmitter
@@ -92,12 +155,201 @@ public:
 	Color backgroundColor;
 
 	/**
-	 * The total number of Game Objects which were rendered in a frame.
+	 * The total number of batches flushed to the SDL renderer in a frame.
+	 *
+	 * Each flush is a single `SDL_RenderGeometry` call, so this is the number
+	 * of actual draw submissions, not the number of Game Objects rendered.
 	 *
 	 * @since 0.0.0
 	 */
 	unsigned int drawCount = 0;
 
+	/**
+	 * Whether the draw commands are submitted to the SDL renderer and the
+	 * frames presented. `false` with the `NONE` render backend, where the
+	 * batches are still built and counted, then every draw command is
+	 * dropped by the command buffer.
+	 *
+	 * @since 0.0.0
+	 */
+	bool submit = true;
+
+	/**
+	 * The maximum number of quads a single batch can hold before it is
+	 * automatically flushed.
+	 *
+	 * @since 0.0.0
+	 */
+	int batchSize = 4096;
+
+	/**
+	 * The vertices of the quads waiting to be flushed, four per quad, in the
+	 * order: top-left, top-right, bottom-right, bottom-left.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SDL_Vertex> batchVertices;
+
+	/**
+	 * The index buffer shared by every batch. It is built once in `start`
+	 * for `batchSize` quads, as every quad uses the same two triangles.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<int> batchIndices;
+
+	/**
+	 * The texture of the quads in the current batch.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Texture *batchTexture = nullptr;
+
+	/**
+	 * The blend mode of the quads in the current batch.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_BlendMode batchBlendMode = SDL_BLENDMODE_BLEND;
+
+	/**
+	 * The clip rectangle currently applied to the SDL renderer.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Rect clipRect {0, 0, 0, 0};
+
+	/**
+	 * Whether `clipRect` is currently applied to the SDL renderer.
+	 *
+	 * @since 0.0.0
+	 */
+	bool clipEnabled = false;
+
+	/**
+	 * The clip rectangle of the window, kept aside while a texture is the
+	 * render target, as SDL restores it once the window is targeted again.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Rect windowClipRect {0, 0, 0, 0};
+
+	/**
+	 * Whether `windowClipRect` is enabled.
+	 *
+	 * @since 0.0.0
+	 */
+	bool windowClipEnabled = false;
+
+	/**
+	 * The texture currently used as the render target, or `nullptr` for the
+	 * window.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Texture *renderTarget = nullptr;
+
+	/**
+	 * The draw color currently applied to the SDL renderer.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Color drawColor {0x00, 0x00, 0x00, 0xff};
+
+	/**
+	 * The draw blend mode currently applied to the SDL renderer.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_BlendMode drawBlendMode = SDL_BLENDMODE_NONE;
+
+	/**
+	 * The last state applied to each texture, used to skip any SDL call that
+	 * wouldn't change anything.
+	 *
+	 * @since 0.0.0
+	 */
+	std::unordered_map<SDL_Texture*, TextureState> textureStates;
+
+	/**
+	 * The number of render state changes sent to SDL in a frame.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int stateChanges = 0;
+
+	/**
+	 * The number of redundant render state changes that were skipped in a
+	 * frame.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int elidedStateChanges = 0;
+
+	/**
+	 * The number of times the texture or the blend mode changes between two
+	 * consecutive sprites in a frame, once sorted by `sortRecords`. Only
+	 * counted when `GameConfig::textureSort` is set.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int textureSwitches = 0;
+
+	/**
+	 * The number of texture or blend mode changes `sortRecords` removed in a
+	 * frame, compared to the order of the display list.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int savedTextureSwitches = 0;
+
+	/**
+	 * The number of sprites `cullOccluded` skipped in a frame, as opaque
+	 * sprites drawn after them covered them entirely.
+	 *
+	 * @since 0.0.0
+	 */
+	unsigned int occludedDraws = 0;
+
+	/**
+	 * The number of pixels of the sprites skipped by `cullOccluded` in a
+	 * frame, counting the bounding box of each one.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t occludedPixels = 0;
+
+	/**
+	 * The number of frames rendered so far. The Texture Sources drawn in a
+	 * frame are stamped with it.
+	 *
+	 * @since 0.0.0
+	 */
+	Uint64 frameCount = 0;
+
+	/**
+	 * The groups of records built by `sortRecords`, reused by every packet.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<RecordGroup> sortGroups;
+
+	/**
+	 * The record drawn after each record of its group, or `-1` for the last
+	 * one, reused by every packet.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::ptrdiff_t> sortLinks;
+
+	/**
+	 * The render targets of the mask passes, created on first use and shared
+	 * by every Camera.
+	 *
+	 * @since 0.0.0
+	 */
+	RenderTargetPool renderTargets;
+
 	/**
 	 * An intermediary render target, used to render any masked GameObject to it.
 	 *
@@ -108,6 +360,9 @@ public:
 	 *
 	 * The frame buffer is then itself rendered to the renderer of the window.
 	 *
+	 * It is taken from `renderTargets` for the duration of a Camera mask
+	 * pass, and is `nullptr` otherwise.
+	 *
 	 * @since 0.0.0
 	 */
 	SDL_Texture *maskBuffer = nullptr;
@@ -120,6 +375,9 @@ public:
 	 *
 	 * The frame buffer is then itself rendered to the renderer of the window.
 	 *
+	 * It is taken from `renderTargets` for the duration of a Game Object mask
+	 * pass, and is `nullptr` otherwise.
+	 *
 	 * @since 0.0.0
 	 */
 	SDL_Texture *cameraBuffer = nullptr;
@@ -132,12 +390,74 @@ public:
 	 * doesn't cover the entirety of the masked GameObject, whatever isn't covered
 	 * won't be hidden.
 	 *
-	 * This texture has the same size as the renderer, solving this problem.
+	 * It is taken from `renderTargets` while a mask is composited, and is
+	 * `nullptr` otherwise.
 	 *
 	 * @since 0.0.0
 	 */
 	SDL_Texture *maskTexture = nullptr;
 
+	/**
+	 * When the renderer was last resized, in milliseconds. The render targets
+	 * aren't trimmed until the size settles.
+	 *
+	 * @since 0.0.0
+	 */
+	Uint32 resizeTime = 0;
+
+	/**
+	 * The render target of the internal resolution, upscaled to the window
+	 * by `postRender`, or `nullptr` if the Cameras draw to the window.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Texture *frameTarget = nullptr;
+
+	/**
+	 * The size of `frameTarget`.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameWidth = 0;
+
+	/**
+	 * @since 0.0.0
+	 */
+	int frameHeight = 0;
+
+	/**
+	 * The render target the Camera being rendered draws to: the texture of its
+	 * render cache, or `nullptr` for the window.
+	 *
+	 * The masks render back to it.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Texture *outputTarget = nullptr;
+
+	/**
+	 * The area of the intermediary buffers matching `outputTarget`, when it
+	 * isn't the window.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Rect outputArea {0, 0, 0, 0};
+
+	/**
+	 * The render target a Game Object mask renders back to, saved by
+	 * `preRenderMask`.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Texture *maskOutput = nullptr;
+
+	/**
+	 * The render packet reused to render the members of every static layer.
+	 *
+	 * @since 0.0.0
+	 */
+	RenderPacket layerPacket;
+
 	/**
 	 * The mask texture's blend mode.
 	 *
@@ -159,59 +479,195 @@ public:
 	 *
 	 * @since 0.0.0
 	 */
-	SDL_BlendMode maskBlendMode;
+	SDL_BlendMode maskBlendMode;
+
+	/**
+	 * The supported blend modes of this Renderer.
+	 *
+	 * @since 0.0.0
+	 */
+	std::map<BLEND_MODE, SDL_BlendMode> blendModes;
+
+	/**
+	 * The width of the renderer of the window.
+	 *
+	 * @since 0.0.0
+	 */
+	int width = 0;
+
+	/**
+	 * The width of the renderer of the window.
+	 *
+	 * @since 0.0.0
+	 */
+	int height = 0;
+
+	/**
+	 * The workers preparing the render packets in parallel. They are only
+	 * started if `GameConfig::parallelRender` is set.
+	 *
+	 * @since 0.0.0
+	 */
+	ThreadPool workers;
+
+	/**
+	 * The minimum number of records given to each worker when preparing a
+	 * render packet. Packets smaller than that are prepared on a single
+	 * thread.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t prepareChunkSize = 256;
+
+	/**
+	 * A temporary Transform Matrix, re-used internally during batching.
+	 *
+	 * @since 0.0.0
+	 */
+	Components::TransformMatrix tempMatrix1;
+
+	/**
+	 * A temporary Transform Matrix, re-used internally during batching.
+	 *
+	 * @since 0.0.0
+	 */
+	Components::TransformMatrix tempMatrix2;
+
+	/**
+	 * A temporary Transform Matrix, re-used internally during batching.
+	 *
+	 * @since 0.0.0
+	 */
+	Components::TransformMatrix tempMatrix3;
+
+	/**
+	 * The snapshots scheduled for the current frame. They are all read from
+	 * the window at once, after the frame is fully rendered.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SnapshotState> snapshotQueue;
+
+	/**
+	 * The pixel buffers of past readbacks, reused by the next ones.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::vector<Uint32>> snapshotBuffers;
+
+	/**
+	 * The snapshots the worker finished, reported on the next frame.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SnapshotResult> snapshotResults;
+
+	/**
+	 * Guards `snapshotBuffers` and `snapshotResults`, shared with the
+	 * snapshot worker.
+	 *
+	 * @since 0.0.0
+	 */
+	std::mutex snapshotMutex;
+
+	/**
+	 * The worker encoding the snapshots and calling their callbacks. It is
+	 * declared after the buffers so that it stops before they are destroyed.
+	 *
+	 * @since 0.0.0
+	 */
+	ThreadPool snapshotWorker;
+
+	/**
+	 * The recording of the rendered frames, see `startCapture`.
+	 *
+	 * @since 0.0.0
+	 */
+	FrameCapture capture;
+
+	/**
+	 * Every call to the SDL renderer goes through it. With deferred
+	 * rendering, the calls of a frame are recorded, then executed by
+	 * `postRender`.
+	 *
+	 * @since 0.0.0
+	 */
+	RenderCommandBuffer commandBuffer;
 
 	/**
-	 * The supported blend modes of this Renderer.
+	 * The file the commands of the next frame are saved to, see
+	 * `saveCommands`. Empty if none.
 	 *
 	 * @since 0.0.0
 	 */
-	std::map<BLEND_MODE, SDL_BlendMode> blendModes;
+	std::string commandsPath;
 
 	/**
-	 * The width of the renderer of the window.
+	 * Whether the update of a frame overlaps the submission of the previous
+	 * one, see `GameConfig::setPipelinedRendering`.
 	 *
 	 * @since 0.0.0
 	 */
-	int width = 0;
+	bool pipelined = false;
 
 	/**
-	 * The width of the renderer of the window.
+	 * The render commands of the last recorded frame, waiting to be
+	 * submitted by `overlap` while `commandBuffer` records the next one.
 	 *
 	 * @since 0.0.0
 	 */
-	int height = 0;
+	RenderCommandBuffer submitBuffer;
 
 	/**
-	 * A temporary Transform Matrix, re-used internally during batching.
+	 * Whether `submitBuffer` holds a frame to submit and present.
 	 *
 	 * @since 0.0.0
 	 */
-	Components::TransformMatrix tempMatrix1;
+	bool pendingFrame = false;
 
 	/**
-	 * A temporary Transform Matrix, re-used internally during batching.
+	 * The thread owning the SDL renderer.
 	 *
 	 * @since 0.0.0
 	 */
-	Components::TransformMatrix tempMatrix2;
+	std::thread::id mainThread;
 
 	/**
-	 * A temporary Transform Matrix, re-used internally during batching.
+	 * The tasks given to `invoke` by the pipeline worker, run by the main
+	 * thread.
 	 *
 	 * @since 0.0.0
 	 */
-	Components::TransformMatrix tempMatrix3;
+	std::deque<std::function<void()>> mainTasks;
+
+	/**
+	 * Whether the work given to `overlap` is done.
+	 *
+	 * @since 0.0.0
+	 */
+	bool workDone = true;
+
+	/**
+	 * Guards `mainTasks` and `workDone`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::mutex taskMutex;
 
 	/**
-	 * Details about the currently scheduled snapshot.
+	 * Wakes up the main thread when a task is queued or the work is done,
+	 * and the worker when its task is done.
 	 *
-	 * If `active` is set to `true` this object, a snapshot of the canvas will be
-	 * taken after the current frame is fully rendered.
+	 * @since 0.0.0
+	 */
+	std::condition_variable taskCondition;
+
+	/**
+	 * The worker updating the scenes with pipelined rendering.
 	 *
 	 * @since 0.0.0
 	 */
-	SnapshotState snapshotState;
+	ThreadPool pipelineWorker;
 
 	/**
 	 * Start up this renderer. This _MUST_ run after the Window was created!
@@ -242,6 +698,8 @@ public:
 	/**
 	 * Resize the main game canvas.
 	 *
+	 * Nothing is reallocated here: the mask buffers are sized on use.
+	 *
 	 * @since 0.0.0
 	 *
 	 * @param width_ The new width of the renderer.
@@ -252,15 +710,79 @@ public:
 	/**
 	 * Called at the start of the render loop.
 	 *
+	 * At an internal resolution, this redirects the rendering to
+	 * `frameTarget`.
+	 *
 	 * @since 0.0.0
 	 */
 	void preRender ();
 
+	/**
+	 * Extracts everything needed to render the given Game Objects with a
+	 * Camera into a render packet.
+	 *
+	 * This is the only step of the rendering reading the registry. Game
+	 * Objects that don't pass the `WillRender` test against the Camera are
+	 * skipped, unless the caller already tested them.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param children_ The Game Objects to extract, in render order.
+	 * @param camera_ The Scene Camera to render with.
+	 * @param packet_ The packet to fill. Its previous content is cleared.
+	 * @param visible_ Whether every Game Object of `children_` is known to
+	 * pass the `WillRender` test, like those given by the CameraManager.
+	 */
+	void extract (const std::vector<Entity>& children_, Entity camera_, RenderPacket& packet_, bool visible_ = false);
+
+	/**
+	 * Computes the transform matrices and the window space quads of every
+	 * sprite record of a render packet, and culls those outside of the Camera
+	 * viewport if the Camera culls.
+	 *
+	 * The records are split across the workers if they are running. This
+	 * doesn't read the registry, only the packet.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param packet_ The render packet to prepare.
+	 */
+	void prepare (RenderPacket& packet_);
+
+	/**
+	 * With `GameConfig::textureSort`, sets the `order` of a prepared packet
+	 * so that, among consecutive sprites of equal depth, the ones sharing a
+	 * texture and a blend mode are drawn together.
+	 *
+	 * A sprite is only drawn earlier if it overlaps none of the sprites it
+	 * moves before, so the frame looks the same. Masked sprites and text
+	 * keep their place.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param packet_ The render packet to sort.
+	 */
+	void sortRecords (RenderPacket& packet_);
+
+	/**
+	 * With `GameConfig::overdrawCulling`, culls the sprites of a prepared
+	 * packet that opaque sprites drawn after them fully cover.
+	 *
+	 * A sprite covers others if its frame is fully opaque, its quad is
+	 * axis-aligned, it is unmasked, at full alpha, and drawn with the
+	 * `SDL_BLENDMODE_BLEND` or `SDL_BLENDMODE_NONE` blend mode. Only the
+	 * largest of those areas are tested against.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param packet_ The render packet to cull.
+	 */
+	void cullOccluded (RenderPacket& packet_);
+
 	/**
 	 * The core render step for a Scene Camera.
 	 *
-	 * Iterates through the given array of Game Objects and renders them with
-	 * the given Camera.
+	 * Iterates through the records of the given render packet and draws them.
 	 *
 	 * This is called by the CameraManager::render method. The Camera Manager
 	 * instance belongs to a Scene, and is invoked by the
@@ -272,13 +794,64 @@ public:
 	 * @since 0.0.0
 	 *
 	 * @param scene_ The Scene to render.
-	 * @param children_ An array of filtered Game Objects that can be rendered by the given Camera.
-	 * @param camera_ The Scene Camera to render with.
+	 * @param packet_ The render packet extracted for the Camera.
+	 */
+	void render (Scene& scene_, const RenderPacket& packet_);
+
+	/**
+	 * Redirects the rendering of a Camera to the texture of its render cache.
+	 *
+	 * This must be called between `extract` and `prepare`, as it moves the
+	 * viewport of the packet to the texture, scaled by the resolution of the
+	 * cache. The texture is created or resized as needed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param packet_ The render packet extracted for the Camera.
+	 * @param cache_ The render cache of the Camera.
+	 *
+	 * @return `false` if the Camera has nothing to render, in which case the
+	 * rendering isn't redirected.
+	 */
+	bool beginCache (RenderPacket& packet_, Components::RenderCache& cache_);
+
+	/**
+	 * Ends the rendering into a render cache started by `beginCache`, and
+	 * restores the window as the render target.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param cache_ The render cache of the Camera.
+	 */
+	void endCache (Components::RenderCache& cache_);
+
+	/**
+	 * Draws the texture of a render cache over the viewport of its Camera.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param cache_ The render cache to draw.
 	 */
-	void render (Scene& scene_, std::vector<Entity> children_, Entity camera_);
+	void drawCache (const Components::RenderCache& cache_);
 
 	/**
-	 * Takes a snapshot if one is scheduled.
+	 * Renders the members of every static layer of a Scene that changed since
+	 * its last render into the texture of the layer.
+	 *
+	 * This is called by SceneSystems::render before the Cameras render, so
+	 * that the layers are drawn up to date.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param scene_ The Scene to render the layers of.
+	 */
+	void renderLayers (Scene& scene_);
+
+	/**
+	 * Presents the frame and takes the scheduled snapshots.
+	 *
+	 * At an internal resolution, `frameTarget` is first drawn to the area of
+	 * the window the game is displayed in.
 	 *
 	 * The post-render step happens after all Cameras in all Scenes have been
 	 * rendered.
@@ -294,8 +867,11 @@ public:
 	 * To capture a specific area see the snapshotArea method. To capture a
 	 * specific pixel, see snapshotPixel.
 	 *
-	 * Only one snapshot can be active _per frame_. If you have already called
-	 * snapshotPixel, for example, then calling this method will override it.
+	 * Any number of snapshots can be scheduled per frame, they share a single
+	 * read of the window. The file is saved and the callback called on the
+	 * snapshot worker thread, so the callback must not touch the registry.
+	 * The surface is only valid during the callback. The Renderer then emits
+	 * a `snapshot` event with a SnapshotResult, on the main thread.
 	 *
 	 * @since 0.0.0
 	 *
@@ -314,8 +890,8 @@ public:
 	 * To capture the whole game viewport see the snapshot method. To capture a
 	 * specific pixel, see snapshotPixel.
 	 *
-	 * Only one snapshot can be active _per frame_. If you have already called
-	 * snapshotPixel, for example, then calling this method will override it.
+	 * Like `snapshot`, the file is saved and the callback called on the
+	 * snapshot worker thread.
 	 *
 	 * @since 0.0.0
 	 *
@@ -338,12 +914,9 @@ public:
 	 * To capture the whole game viewport see the `snapshot` method. To capture a
 	 * specific area, see `snapshotArea`.
 	 *
-	 * Only one snapshot can be active _per frame_. If you have already called
-	 * snapshotArea, for example, then
-	 * calling this method will override it.
-	 *
 	 * Unlike the other two snapshot methods, this one will return a Color
-	 * object containing the color data for the requested pixel.
+	 * object containing the color data for the requested pixel. The callback
+	 * is called on the snapshot worker thread.
 	 *
 	 * @since 0.0.0
 	 *
@@ -368,46 +941,365 @@ public:
 	Renderer& snapshotPixel (int x_, int y_, std::function<void(Color)>&& callback_);
 
 	/**
-	 * Takes a Sprite Game Object, or any object that extends it, and draws it
-	 * to the window.
+	 * Starts recording every `interval`-th rendered frame of the window to
+	 * disk, as an image sequence or a raw video stream.
+	 *
+	 * The frames are written by a writer thread. If it falls behind, the
+	 * frames are dropped rather than slowing the game down, see
+	 * `getCaptureStats`. Frames skipped by `GameConfig::renderOnChange` aren't
+	 * recorded.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param config_ The capture settings.
+	 *
+	 * @return `false` if the capture couldn't start.
+	 */
+	bool startCapture (const CaptureConfig& config_);
+
+	/**
+	 * Stops the recording, once the frames already captured are written.
+	 *
+	 * @since 0.0.0
+	 */
+	void stopCapture ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The counters of the current or last recording.
+	 */
+	CaptureStats getCaptureStats () const;
+
+	/**
+	 * Records the render commands of the next frame and saves them to a
+	 * file, even without deferred rendering.
+	 *
+	 * The file can be replayed on its own with `RenderCommandBuffer::load`
+	 * and `RenderCommandBuffer::execute`, to benchmark the rendering of that
+	 * frame.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param path_ The file to write.
+	 *
+	 * @return This Renderer instance.
+	 */
+	Renderer& saveCommands (std::string path_);
+
+	/**
+	 * Extracts a Sprite Game Object, or any object that extends it, into a
+	 * draw record.
 	 *
 	 * @since 0.0.0
 	 *
-	 * @param sprite_ The texture based Game Object to draw.
+	 * @param sprite_ The texture based Game Object to extract.
 	 * @param frame_ The frame to draw, doesn't have to be owned by the
 	 * GameObject.
 	 * @param camera_ The Camera to use for the rendering transform.
 	 * @param parentTransformMatrix_ The transform matrix of the parent
 	 * container, if set.
+	 * @param packet_ The render packet to add the record to.
+	 *
+	 * @return The index of the new record, or `-1` if there is nothing to
+	 * draw.
 	 */
-	void batchSprite (
+	int extractSprite (
 			Entity sprite_,
 			Entity frame_,
 			Entity camera_,
-			Components::TransformMatrix* parentTransformMatrix_ = nullptr);
+			Components::TransformMatrix* parentTransformMatrix_,
+			RenderPacket& packet_);
+
+	/**
+	 * Extracts a mask Game Object into a draw record.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param mask_ The Game Object used as a mask.
+	 * @param camera_ The Camera to use for the rendering transform.
+	 * @param packet_ The render packet to add the record to.
+	 *
+	 * @return The index of the new record, or `-1` if there is nothing to
+	 * draw.
+	 */
+	int extractMask (Entity mask_, Entity camera_, RenderPacket& packet_);
+
+	/**
+	 * Extracts a rectangle mask into a `RECT` record, whose quad is used as a
+	 * clip rectangle.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param rect_ The rectangle, in world space.
+	 * @param camera_ The Camera to use for the rendering transform.
+	 * @param packet_ The render packet to add the record to.
+	 *
+	 * @return The index of the new record.
+	 */
+	int extractRectMask (const Rectangle& rect_, Entity camera_, RenderPacket& packet_);
+
+	/**
+	 * Adds a sprite record of a render packet to the current batch. The packet
+	 * must have been prepared.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param packet_ The render packet holding the record.
+	 * @param index_ The index of the record.
+	 */
+	void batchRecord (const RenderPacket& packet_, std::size_t index_);
+
+	/**
+	 * Adds a textured quad to the current batch.
+	 *
+	 * If the texture or the blend mode differ from the ones of the current
+	 * batch, or if the batch is full, the current batch is flushed first.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture_ The SDL texture to sample from.
+	 * @param blendMode_ The blend mode to draw the quad with.
+	 * @param quad_ The four corners of the quad in screen space, in the order:
+	 * top-left, top-right, bottom-right, bottom-left.
+	 * @param uv_ The texture coordinates of the quad: u0, v0, u1, v1.
+	 * @param colors_ The color of each corner, in the same order as `quad_`.
+	 */
+	void batchQuad (
+			SDL_Texture *texture_,
+			SDL_BlendMode blendMode_,
+			const SDL_FPoint quad_[4],
+			const float uv_[4],
+			const SDL_Color colors_[4]);
+
+	/**
+	 * Submits every quad of the current batch to the SDL renderer with a
+	 * single `SDL_RenderGeometry` call.
+	 *
+	 * This must be called before any direct SDL rendering operation, such as
+	 * changing the render target, so that the draw order is preserved.
+	 *
+	 * @since 0.0.0
+	 */
+	void flush ();
+
+	/**
+	 * Sets the clip rectangle of the SDL renderer, flushing the current batch
+	 * if it changes.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param rect_ The clip rectangle, or `nullptr` to disable clipping.
+	 */
+	void setClipRect (const SDL_Rect *rect_);
+
+	/**
+	 * Sets the render target of the SDL renderer, flushing the current batch
+	 * if it changes.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param target_ The texture to render to, or `nullptr` for the window.
+	 */
+	void setRenderTarget (SDL_Texture *target_);
+
+	/**
+	 * Sets the draw color of the SDL renderer if it changed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param red_ The red channel.
+	 * @param green_ The green channel.
+	 * @param blue_ The blue channel.
+	 * @param alpha_ The alpha channel.
+	 */
+	void setDrawColor (Uint8 red_, Uint8 green_, Uint8 blue_, Uint8 alpha_);
+
+	/**
+	 * Sets the draw blend mode of the SDL renderer if it changed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param blendMode_ The blend mode used by fill and clear operations.
+	 */
+	void setDrawBlendMode (SDL_BlendMode blendMode_);
+
+	/**
+	 * Sets the color modulation of a texture if it changed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture_ The texture to modulate.
+	 * @param red_ The red channel.
+	 * @param green_ The green channel.
+	 * @param blue_ The blue channel.
+	 */
+	void setTextureColorMod (SDL_Texture *texture_, Uint8 red_, Uint8 green_, Uint8 blue_);
+
+	/**
+	 * Sets the alpha modulation of a texture if it changed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture_ The texture to modulate.
+	 * @param alpha_ The alpha multiplier.
+	 */
+	void setTextureAlphaMod (SDL_Texture *texture_, Uint8 alpha_);
+
+	/**
+	 * Sets the blend mode of a texture if it changed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture_ The texture to set the blend mode of.
+	 * @param blendMode_ The blend mode.
+	 */
+	void setTextureBlendMode (SDL_Texture *texture_, SDL_BlendMode blendMode_);
+
+	/**
+	 * Drops the recorded state of a texture. This _MUST_ be called before
+	 * destroying an SDL texture, as its address could be reused by another one.
+	 * `destroyTexture` does it.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture_ The texture about to be destroyed.
+	 */
+	void forgetTexture (SDL_Texture *texture_);
+
+	/**
+	 * Forgets the state of a texture and destroys it, once the render
+	 * commands recorded so far no longer need it.
+	 *
+	 * Use this rather than `SDL_DestroyTexture` for any texture the Renderer
+	 * may have drawn.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture_ The texture to destroy.
+	 */
+	void destroyTexture (SDL_Texture *texture_);
+
+	/**
+	 * Runs a task on the main thread, which owns the SDL renderer, and waits
+	 * for it.
+	 *
+	 * During a pipelined update, SDL must not be called from the worker:
+	 * creating or loading a texture goes through this instead. Anywhere
+	 * else, the task runs immediately.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param task_ The task to run.
+	 */
+	void invoke (const std::function<void()>& task_);
+
+	/**
+	 * Runs `work_`, with pipelined rendering on the pipeline worker, while
+	 * the frame recorded by the last `postRender` is submitted on the
+	 * calling thread. Returns once both are done.
+	 *
+	 * The submitted frame only reads its own render commands, never the
+	 * registry: everything it draws was copied into them while recording.
+	 * The textures they use stay alive, as `destroyTexture` waits for them
+	 * to be submitted.
+	 *
+	 * Without pipelined rendering, `work_` simply runs on the calling thread.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param work_ The update of the next frame.
+	 */
+	void overlap (const std::function<void()>& work_);
+
+	/**
+	 * Reads the whole tracked state back from the SDL renderer, and forgets
+	 * the state of every texture.
+	 *
+	 * Use this if something bypassed the Renderer to change the SDL state.
+	 *
+	 * @since 0.0.0
+	 */
+	void resetState ();
 
-	void preRenderMask (
-			Entity maskedObject_ = entt::null);
+	/**
+	 * Redirects the rendering to a mask buffer, until `postRenderMask` is
+	 * called.
+	 *
+	 * Only `bounds_` is cleared and composited back: the masked records and
+	 * the mask must not draw outside of it. The buffer is taken from
+	 * `renderTargets`, large enough to cover it.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param cameraMask_ Whether the mask applies to a whole Camera rather
+	 * than Game Objects.
+	 * @param bounds_ The area of the buffers the masked records cover, in
+	 * render target coordinates.
+	 *
+	 * @return `false` if no buffer could be created, in which case the
+	 * rendering is left untouched and `postRenderMask` must not be called.
+	 */
+	bool preRenderMask (bool cameraMask_, const SDL_Rect& bounds_);
 
+	/**
+	 * Draws a mask record over what was rendered since `preRenderMask`, then
+	 * draws the result to the render target that was current before it.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param packet_ The render packet holding the mask record.
+	 * @param maskIndex_ The index of the mask record.
+	 * @param cameraMask_ Whether the mask applies to a whole Camera rather
+	 * than Game Objects.
+	 * @param bounds_ The area passed to `preRenderMask`.
+	 */
 	void postRenderMask (
-			Entity maskObject_,
-			Entity maskedObject_,
-			Entity camera_);
+			const RenderPacket& packet_,
+			int maskIndex_,
+			bool cameraMask_,
+			const SDL_Rect& bounds_);
+
+	/**
+	 * Creates, resizes or destroys `frameTarget` to match the internal
+	 * resolution of the Scale Manager.
+	 *
+	 * @since 0.0.0
+	 */
+	void updateFrameTarget ();
+
+	/**
+	 * Executes and presents the frame waiting in `submitBuffer`, if any.
+	 *
+	 * @since 0.0.0
+	 */
+	void submitFrame ();
 
 private:
 	/**
-	 * Takes a snapshot of an area from the current frame.
+	 * Reads the area covering every scheduled snapshot from the current
+	 * frame into a pooled buffer, then hands the snapshots to the worker.
+	 *
+	 * @since 0.0.0
+	 */
+	void takeSnapshots ();
+
+	/**
+	 * Emits a `snapshot` event for each snapshot the worker finished.
 	 *
 	 * @since 0.0.0
 	 */
-	void takeSnapshot ();
+	void dispatchSnapshots ();
 
 	/**
-	 * Saves the snapshot surface in an image file.
+	 * Takes a pixel buffer from the pool, or allocates one. It goes back to
+	 * the pool once the last snapshot using it is done.
 	 *
 	 * @since 0.0.0
+	 *
+	 * @param size_ The number of pixels of the buffer.
 	 */
-	void saveSnapshot ();
+	std::shared_ptr<std::vector<Uint32>> acquireSnapshotBuffer (std::size_t size_);
 };
 
 }	// namespace Zen
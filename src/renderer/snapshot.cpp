@@ -0,0 +1,305 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include "../window/window.hpp"
+#include "../math/clamp.hpp"
+#include "../display/color.hpp"
+#include "../utils/messages.hpp"
+#include "../systems/dirty.hpp"
+
+namespace Zen {
+
+extern Window g_window;
+
+/**
+ * The number of readback buffers kept for the next snapshots.
+ */
+static const std::size_t MAX_SNAPSHOT_BUFFERS = 2;
+
+/**
+ * Saves a surface in an image file, whose type is given by the extension of
+ * its path.
+ *
+ * @return `true` if the file was saved.
+ */
+static bool SaveSurface (SDL_Surface *surface_, const std::string& path_)
+{
+	std::string extension_ = "";
+
+	// Figure out the file type
+	for (auto c_ = path_.rbegin(); c_ != path_.rend(); c_++) {
+		if (*c_ == '.')
+		{
+			// We read all the extension's characters
+			break;
+		}
+
+		extension_.insert(0, 1, *c_);
+	}
+
+	if (extension_ == "bmp")
+	{
+		if (SDL_SaveBMP(surface_, path_.c_str()))
+		{
+			MessageError("Failed to save snapshot in a 'BMP' file: ", SDL_GetError());
+			return false;
+		}
+	}
+	else if (extension_ == "png")
+	{
+		if (IMG_SavePNG(surface_, path_.c_str()))
+		{
+			MessageError("Failed to save snapshot in a 'PNG' file: ", IMG_GetError());
+			return false;
+		}
+	}
+	else if (extension_ == "jpg" || extension_ == "jpeg")
+	{
+		if (IMG_SaveJPG(surface_, path_.c_str(), 100))
+		{
+			MessageError("Failed to save snapshot in a 'JPG' file: ", IMG_GetError());
+			return false;
+		}
+	}
+	else
+	{
+		MessageError("File type unsupported! Try something else like 'png' or 'jpg'.");
+		return false;
+	}
+
+	return true;
+}
+
+Renderer& Renderer::snapshot (std::string path_, std::function<void(SDL_Surface*)> callback_)
+{
+	return snapshotArea(0, 0, g_window.width(), g_window.height(), path_, callback_);
+}
+
+Renderer& Renderer::snapshotArea (
+		int x_,
+		int y_,
+		int width_,
+		int height_,
+		std::string path_,
+		std::function<void(SDL_Surface*)> callback_)
+{
+	SnapshotState request_;
+
+	request_.callback = callback_;
+
+	request_.path = path_;
+
+	request_.x = Math::Clamp(x_, 0, g_window.width());
+
+	request_.y = Math::Clamp(y_, 0, g_window.height());
+
+	request_.width = Math::Clamp(
+			width_,
+			0,
+			g_window.width() - request_.x);
+
+	request_.height = Math::Clamp(
+			height_,
+			0,
+			g_window.height() - request_.y);
+
+	snapshotQueue.emplace_back(std::move(request_));
+
+	// The snapshot is taken from a rendered frame
+	MarkFrameDirty();
+
+	return *this;
+}
+
+Renderer& Renderer::snapshotPixel (int x_, int y_, std::function<void(Color)>& callback_)
+{
+	snapshotArea(x_, y_, 1, 1, "", nullptr);
+
+	snapshotQueue.back().getPixel = true;
+	snapshotQueue.back().callbackPixel = callback_;
+
+	return *this;
+}
+
+Renderer& Renderer::snapshotPixel (int x_, int y_, std::function<void(Color)>&& callback_)
+{
+	return snapshotPixel(x_, y_, callback_);
+}
+
+void Renderer::takeSnapshots ()
+{
+	if (snapshotQueue.empty())
+		return;
+
+	// The area covering every snapshot, read in one go
+	int left_ = g_window.width(), top_ = g_window.height();
+	int right_ = 0, bottom_ = 0;
+
+	for (auto& request_ : snapshotQueue)
+	{
+		if (request_.width <= 0 || request_.height <= 0)
+			continue;
+
+		left_ = std::min(left_, request_.x);
+		top_ = std::min(top_, request_.y);
+		right_ = std::max(right_, request_.x + request_.width);
+		bottom_ = std::max(bottom_, request_.y + request_.height);
+	}
+
+	if (right_ <= left_ || bottom_ <= top_)
+	{
+		snapshotQueue.clear();
+		return;
+	}
+
+	SDL_Rect area_ {left_, top_, right_ - left_, bottom_ - top_};
+
+	auto buffer_ = acquireSnapshotBuffer(static_cast<std::size_t>(area_.w) * area_.h);
+
+	// A fixed format, the window surface isn't needed to know it
+	if (SDL_RenderReadPixels(
+				g_window.renderer,
+				&area_,
+				SDL_PIXELFORMAT_ARGB8888,
+				buffer_->data(),
+				area_.w * 4))
+	{
+		MessageError("Failed to read the window pixel data: ", SDL_GetError());
+
+		std::lock_guard<std::mutex> lock_(snapshotMutex);
+		for (auto& request_ : snapshotQueue)
+			snapshotResults.push_back({request_.path, false});
+
+		snapshotQueue.clear();
+		return;
+	}
+
+	// The encoding and the callbacks share the buffer on the worker
+	for (auto& request_ : snapshotQueue)
+	{
+		snapshotWorker.enqueue([this, buffer_, area_, request_ = std::move(request_)] () {
+			SnapshotResult result_ {request_.path, true};
+
+			if (request_.width > 0 && request_.height > 0)
+			{
+				Uint32 *pixels_ = buffer_->data() +
+					static_cast<std::size_t>(request_.y - area_.y) * area_.w +
+					(request_.x - area_.x);
+
+				if (request_.getPixel)
+				{
+					Color out_;
+					SetTo(&out_,
+							(*pixels_ >> 16) & 0xff,
+							(*pixels_ >> 8) & 0xff,
+							*pixels_ & 0xff,
+							(*pixels_ >> 24) & 0xff);
+
+					if (request_.callbackPixel)
+						request_.callbackPixel(out_);
+				}
+				else
+				{
+					// A view of the buffer, nothing is copied
+					SDL_Surface *surface_ = SDL_CreateRGBSurfaceWithFormatFrom(
+							pixels_,
+							request_.width,
+							request_.height,
+							32,
+							area_.w * 4,
+							SDL_PIXELFORMAT_ARGB8888);
+
+					if (!surface_)
+					{
+						MessageError("Failed to create an RGB surface: ", SDL_GetError());
+						result_.success = false;
+					}
+					else
+					{
+						// Save an image file if a path is given
+						if (request_.path != "")
+							result_.success = SaveSurface(surface_, request_.path);
+
+						// Call the callback if one was given
+						if (request_.callback)
+							request_.callback(surface_);
+
+						SDL_FreeSurface(surface_);
+					}
+				}
+			}
+
+			std::lock_guard<std::mutex> lock_(snapshotMutex);
+			snapshotResults.emplace_back(std::move(result_));
+		});
+	}
+
+	snapshotQueue.clear();
+}
+
+void Renderer::dispatchSnapshots ()
+{
+	std::vector<SnapshotResult> results_;
+
+	{
+		std::lock_guard<std::mutex> lock_(snapshotMutex);
+		results_.swap(snapshotResults);
+	}
+
+	for (auto& result_ : results_)
+		emit("snapshot", result_);
+}
+
+bool Renderer::startCapture (const CaptureConfig& config_)
+{
+	return capture.start(config_, g_window.width(), g_window.height());
+}
+
+void Renderer::stopCapture ()
+{
+	capture.stop();
+}
+
+CaptureStats Renderer::getCaptureStats () const
+{
+	return capture.getStats();
+}
+
+std::shared_ptr<std::vector<Uint32>> Renderer::acquireSnapshotBuffer (std::size_t size_)
+{
+	std::vector<Uint32> buffer_;
+
+	{
+		std::lock_guard<std::mutex> lock_(snapshotMutex);
+
+		if (!snapshotBuffers.empty())
+		{
+			buffer_ = std::move(snapshotBuffers.back());
+			snapshotBuffers.pop_back();
+		}
+	}
+
+	buffer_.resize(size_);
+
+	// Back to the pool once the last snapshot reading it is done
+	return std::shared_ptr<std::vector<Uint32>>(
+			new std::vector<Uint32>(std::move(buffer_)),
+			[this] (std::vector<Uint32> *used_) {
+				{
+					std::lock_guard<std::mutex> lock_(snapshotMutex);
+
+					if (snapshotBuffers.size() < MAX_SNAPSHOT_BUFFERS)
+						snapshotBuffers.emplace_back(std::move(*used_));
+				}
+
+				delete used_;
+			});
+}
+
+}	// namespace Zen
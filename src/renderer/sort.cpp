@@ -0,0 +1,198 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include <cfloat>
+
+#include "../core/config.hpp"
+#include "../components/depth.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+/**
+ * @return Whether the record can be drawn at another place of its run.
+ */
+static bool IsSortable (const RenderPacket& packet_, std::size_t index_)
+{
+	return packet_.kinds[index_] == RENDER_RECORD::SPRITE &&
+		packet_.masks[index_] < 0;
+}
+
+/**
+ * @return The depth of the Game Object of a record, `0` if it has none.
+ */
+static int RecordDepth (const RenderPacket& packet_, std::size_t index_)
+{
+	auto depth_ = g_registry.try_get<Components::Depth>(packet_.entities[index_]);
+
+	return depth_ ? depth_->value : 0;
+}
+
+/**
+ * Counts the changes of texture or blend mode between the drawn sprites of a
+ * packet, in their draw order.
+ */
+static unsigned int CountSwitches (const RenderPacket& packet_)
+{
+	unsigned int switches_ = 0;
+
+	const SDL_Texture *texture_ = nullptr;
+	SDL_BlendMode blendMode_ = SDL_BLENDMODE_NONE;
+	bool first_ = true;
+
+	for (std::size_t p_ = 0; p_ < packet_.count; p_++)
+	{
+		std::size_t i_ = packet_.order.empty() ? p_ : packet_.order[p_];
+
+		if (packet_.kinds[i_] != RENDER_RECORD::SPRITE || packet_.culled[i_])
+			continue;
+
+		if (!first_ && (packet_.textures[i_] != texture_ ||
+					packet_.blendModes[i_] != blendMode_))
+			switches_++;
+
+		texture_ = packet_.textures[i_];
+		blendMode_ = packet_.blendModes[i_];
+		first_ = false;
+	}
+
+	return switches_;
+}
+
+void Renderer::sortRecords (RenderPacket& packet_)
+{
+	packet_.order.clear();
+
+	if (!config->textureSort || packet_.skip || packet_.count < 2)
+		return;
+
+	unsigned int before_ = CountSwitches(packet_);
+
+	packet_.order.reserve(packet_.count);
+	sortLinks.assign(packet_.count, -1);
+
+	std::size_t window_ = std::max(1u, config->textureSortWindow);
+
+	std::size_t i_ = 0;
+	while (i_ < packet_.count)
+	{
+		// Masked sprites and text keep their place
+		if (!IsSortable(packet_, i_))
+		{
+			packet_.order.emplace_back(i_);
+			i_++;
+
+			continue;
+		}
+
+		// The run of sortable records of equal depth
+		int depth_ = RecordDepth(packet_, i_);
+		std::size_t end_ = i_ + 1;
+
+		while (end_ < packet_.count && IsSortable(packet_, end_) &&
+				RecordDepth(packet_, end_) == depth_)
+			end_++;
+
+		sortGroups.clear();
+
+		for (std::size_t j_ = i_; j_ < end_; j_++)
+		{
+			// A culled record isn't drawn, its place doesn't matter
+			if (packet_.culled[j_] && !sortGroups.empty())
+			{
+				sortLinks[sortGroups.back().last] = j_;
+				sortGroups.back().last = j_;
+
+				continue;
+			}
+
+			float left_ = FLT_MAX, top_ = FLT_MAX;
+			float right_ = -FLT_MAX, bottom_ = -FLT_MAX;
+
+			if (!packet_.culled[j_])
+			{
+				const SDL_FPoint *quad_ = &packet_.quads[j_ * 4];
+
+				left_ = std::min({quad_[0].x, quad_[1].x, quad_[2].x, quad_[3].x});
+				right_ = std::max({quad_[0].x, quad_[1].x, quad_[2].x, quad_[3].x});
+				top_ = std::min({quad_[0].y, quad_[1].y, quad_[2].y, quad_[3].y});
+				bottom_ = std::max({quad_[0].y, quad_[1].y, quad_[2].y, quad_[3].y});
+			}
+
+			// Join the latest group of the same texture, unless a group in
+			// between is drawn over it
+			RecordGroup *group_ = nullptr;
+			std::size_t stop_ = sortGroups.size() > window_ ? sortGroups.size() - window_ : 0;
+
+			for (std::size_t k_ = sortGroups.size(); k_-- > stop_;)
+			{
+				auto& candidate_ = sortGroups[k_];
+
+				if (candidate_.texture == packet_.textures[j_] &&
+					candidate_.blendMode == packet_.blendModes[j_])
+				{
+					group_ = &candidate_;
+					break;
+				}
+
+				if (left_ <= candidate_.right && right_ >= candidate_.left &&
+					top_ <= candidate_.bottom && bottom_ >= candidate_.top)
+					break;
+			}
+
+			if (group_)
+			{
+				sortLinks[group_->last] = j_;
+				group_->last = j_;
+			}
+			else
+			{
+				group_ = &sortGroups.emplace_back();
+				group_->texture = packet_.textures[j_];
+				group_->blendMode = packet_.blendModes[j_];
+				group_->left = FLT_MAX;
+				group_->top = FLT_MAX;
+				group_->right = -FLT_MAX;
+				group_->bottom = -FLT_MAX;
+				group_->first = j_;
+				group_->last = j_;
+			}
+
+			group_->left = std::min(group_->left, left_);
+			group_->top = std::min(group_->top, top_);
+			group_->right = std::max(group_->right, right_);
+			group_->bottom = std::max(group_->bottom, bottom_);
+		}
+
+		for (const auto& group_ : sortGroups)
+		{
+			for (std::ptrdiff_t r_ = group_.first; r_ >= 0; r_ = sortLinks[r_])
+				packet_.order.emplace_back(r_);
+		}
+
+		i_ = end_;
+	}
+
+	unsigned int after_ = CountSwitches(packet_);
+
+	// Nothing gained, the index order is cheaper to follow
+	if (after_ >= before_)
+	{
+		packet_.order.clear();
+		textureSwitches += before_;
+
+		return;
+	}
+
+	textureSwitches += after_;
+	savedTextureSwitches += before_ - after_;
+}
+
+}	// namespace Zen
@@ -0,0 +1,243 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "renderer.hpp"
+
+#include "../window/window.hpp"
+#include "../utils/messages.hpp"
+
+namespace Zen {
+
+extern Window g_window;
+
+/**
+ * Returns the tracked state of a texture, reading it back from SDL the first
+ * time the texture is seen.
+ *
+ * @since 0.0.0
+ */
+static TextureState& GetTextureState (
+		std::unordered_map<SDL_Texture*, TextureState>& states_,
+		SDL_Texture *texture_)
+{
+	auto it_ = states_.find(texture_);
+
+	if (it_ != states_.end())
+		return it_->second;
+
+	TextureState state_;
+
+	SDL_GetTextureColorMod(texture_, &state_.color.r, &state_.color.g, &state_.color.b);
+	SDL_GetTextureAlphaMod(texture_, &state_.color.a);
+	SDL_GetTextureBlendMode(texture_, &state_.blendMode);
+
+	return states_.emplace(texture_, state_).first->second;
+}
+
+void Renderer::setClipRect (const SDL_Rect *rect_)
+{
+	if ((!rect_ && !clipEnabled) || (rect_ && clipEnabled &&
+		rect_->x == clipRect.x && rect_->y == clipRect.y &&
+		rect_->w == clipRect.w && rect_->h == clipRect.h))
+	{
+		elidedStateChanges++;
+		return;
+	}
+
+	flush();
+
+	if (rect_)
+	{
+		clipRect = *rect_;
+		clipEnabled = true;
+	}
+	else
+	{
+		clipEnabled = false;
+	}
+
+	commandBuffer.setClipRect(rect_);
+	stateChanges++;
+}
+
+void Renderer::setRenderTarget (SDL_Texture *target_)
+{
+	if (target_ == renderTarget)
+	{
+		elidedStateChanges++;
+		return;
+	}
+
+	flush();
+
+	if (commandBuffer.setTarget(target_))
+	{
+		MessageError("Failed to set the render target: ", SDL_GetError());
+		return;
+	}
+
+	stateChanges++;
+
+	// SDL drops the clip rectangle when a texture becomes the target, and
+	// brings back the one of the window when the window is targeted again
+	if (!renderTarget)
+	{
+		windowClipRect = clipRect;
+		windowClipEnabled = clipEnabled;
+	}
+
+	if (target_)
+	{
+		clipEnabled = false;
+	}
+	else
+	{
+		clipRect = windowClipRect;
+		clipEnabled = windowClipEnabled;
+	}
+
+	renderTarget = target_;
+}
+
+void Renderer::setDrawColor (Uint8 red_, Uint8 green_, Uint8 blue_, Uint8 alpha_)
+{
+	if (drawColor.r == red_ && drawColor.g == green_ && drawColor.b == blue_ &&
+		drawColor.a == alpha_)
+	{
+		elidedStateChanges++;
+		return;
+	}
+
+	drawColor = {red_, green_, blue_, alpha_};
+
+	commandBuffer.setDrawColor(red_, green_, blue_, alpha_);
+	stateChanges++;
+}
+
+void Renderer::setDrawBlendMode (SDL_BlendMode blendMode_)
+{
+	if (drawBlendMode == blendMode_)
+	{
+		elidedStateChanges++;
+		return;
+	}
+
+	drawBlendMode = blendMode_;
+
+	commandBuffer.setDrawBlendMode(blendMode_);
+	stateChanges++;
+}
+
+void Renderer::setTextureColorMod (SDL_Texture *texture_, Uint8 red_, Uint8 green_, Uint8 blue_)
+{
+	auto& state_ = GetTextureState(textureStates, texture_);
+
+	if (state_.color.r == red_ && state_.color.g == green_ && state_.color.b == blue_)
+	{
+		elidedStateChanges++;
+		return;
+	}
+
+	// The batch still pending may be using this texture
+	if (texture_ == batchTexture)
+		flush();
+
+	state_.color.r = red_;
+	state_.color.g = green_;
+	state_.color.b = blue_;
+
+	commandBuffer.setTextureColorMod(texture_, red_, green_, blue_);
+	stateChanges++;
+}
+
+void Renderer::setTextureAlphaMod (SDL_Texture *texture_, Uint8 alpha_)
+{
+	auto& state_ = GetTextureState(textureStates, texture_);
+
+	if (state_.color.a == alpha_)
+	{
+		elidedStateChanges++;
+		return;
+	}
+
+	if (texture_ == batchTexture)
+		flush();
+
+	state_.color.a = alpha_;
+
+	commandBuffer.setTextureAlphaMod(texture_, alpha_);
+	stateChanges++;
+}
+
+void Renderer::setTextureBlendMode (SDL_Texture *texture_, SDL_BlendMode blendMode_)
+{
+	auto& state_ = GetTextureState(textureStates, texture_);
+
+	if (state_.blendMode == blendMode_)
+	{
+		elidedStateChanges++;
+		return;
+	}
+
+	state_.blendMode = blendMode_;
+
+	commandBuffer.setTextureBlendMode(texture_, blendMode_);
+	stateChanges++;
+}
+
+void Renderer::forgetTexture (SDL_Texture *texture_)
+{
+	if (!texture_)
+		return;
+
+	if (texture_ == batchTexture)
+	{
+		flush();
+		batchTexture = nullptr;
+	}
+
+	if (texture_ == renderTarget)
+		setRenderTarget(nullptr);
+
+	textureStates.erase(texture_);
+}
+
+void Renderer::destroyTexture (SDL_Texture *texture_)
+{
+	if (!texture_)
+		return;
+
+	forgetTexture(texture_);
+
+	// Destroyed once the commands recorded with it have run
+	commandBuffer.destroyTexture(texture_);
+}
+
+void Renderer::resetState ()
+{
+	flush();
+
+	// Read the state the recorded commands lead to
+	commandBuffer.execute();
+	commandBuffer.reset();
+
+	textureStates.clear();
+
+	SDL_GetRenderDrawColor(g_window.renderer,
+			&drawColor.r, &drawColor.g, &drawColor.b, &drawColor.a);
+	SDL_GetRenderDrawBlendMode(g_window.renderer, &drawBlendMode);
+
+	renderTarget = SDL_GetRenderTarget(g_window.renderer);
+
+	clipEnabled = SDL_RenderIsClipEnabled(g_window.renderer);
+	SDL_RenderGetClipRect(g_window.renderer, &clipRect);
+
+	windowClipRect = {0, 0, 0, 0};
+	windowClipEnabled = false;
+}
+
+}	// namespace Zen
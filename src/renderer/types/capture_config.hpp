@@ -0,0 +1,81 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_TYPES_CAPTURECONFIG_HPP
+#define ZEN_RENDERER_TYPES_CAPTURECONFIG_HPP
+
+#include <string>
+#include "../../enums/capture_format.hpp"
+
+namespace Zen {
+
+/**
+ * The settings of a frame capture.
+ *
+ * @since 0.0.0
+ */
+struct CaptureConfig
+{
+	/**
+	 * For image sequences, the prefix of the files: frame `42` of `out/run_`
+	 * is saved to `out/run_000042.png`. For a Y4M stream, the file to write.
+	 *
+	 * @since 0.0.0
+	 */
+	std::string path = "capture_";
+
+	/**
+	 * @since 0.0.0
+	 */
+	CAPTURE_FORMAT format = CAPTURE_FORMAT::PNG;
+
+	/**
+	 * Captures one frame out of `interval`.
+	 *
+	 * @since 0.0.0
+	 */
+	int interval = 1;
+
+	/**
+	 * The number of pre-allocated frames waiting to be written. When they
+	 * are all used, the new frames are dropped.
+	 *
+	 * @since 0.0.0
+	 */
+	int ringSize = 8;
+
+	/**
+	 * The frame rate written in the Y4M header. It should be the rate of the
+	 * game divided by `interval`.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameRate = 60;
+};
+
+/**
+ * The counters of a frame capture.
+ *
+ * @since 0.0.0
+ *
+ * @property captured The number of frames read from the window.
+ * @property written The number of frames written to disk.
+ * @property dropped The number of frames skipped because the ring was full
+ * or the window couldn't be read.
+ */
+struct CaptureStats
+{
+	unsigned long captured = 0;
+
+	unsigned long written = 0;
+
+	unsigned long dropped = 0;
+};
+
+}	// namespace Zen
+
+#endif
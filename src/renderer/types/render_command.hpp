@@ -0,0 +1,142 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_TYPES_RENDERCOMMAND_HPP
+#define ZEN_RENDERER_TYPES_RENDERCOMMAND_HPP
+
+#include <SDL2/SDL.h>
+#include <cstddef>
+
+namespace Zen {
+
+/**
+ * The SDL call a render command stands for.
+ *
+ * @since 0.0.0
+ */
+enum class RENDER_COMMAND : Uint32 {
+	/**
+	 * `SDL_SetRenderTarget`, with `texture` as the target.
+	 *
+	 * @since 0.0.0
+	 */
+	TARGET,
+
+	/**
+	 * `SDL_RenderSetClipRect`, with `destination` as the rectangle, or none
+	 * if `hasDestination` is `false`.
+	 *
+	 * @since 0.0.0
+	 */
+	CLIP,
+
+	/**
+	 * `SDL_SetRenderDrawColor`, with `color`.
+	 *
+	 * @since 0.0.0
+	 */
+	DRAW_COLOR,
+
+	/**
+	 * `SDL_SetRenderDrawBlendMode`, with `blendMode`.
+	 *
+	 * @since 0.0.0
+	 */
+	DRAW_BLEND_MODE,
+
+	/**
+	 * `SDL_SetTextureBlendMode` of `texture`, with `blendMode`.
+	 *
+	 * @since 0.0.0
+	 */
+	TEXTURE_BLEND_MODE,
+
+	/**
+	 * `SDL_SetTextureColorMod` of `texture`, with the RGB channels of
+	 * `color`.
+	 *
+	 * @since 0.0.0
+	 */
+	TEXTURE_COLOR_MOD,
+
+	/**
+	 * `SDL_SetTextureAlphaMod` of `texture`, with the alpha of `color`.
+	 *
+	 * @since 0.0.0
+	 */
+	TEXTURE_ALPHA_MOD,
+
+	/**
+	 * `SDL_RenderClear`.
+	 *
+	 * @since 0.0.0
+	 */
+	CLEAR,
+
+	/**
+	 * `SDL_RenderFillRect`, with `destination`, or the whole target if
+	 * `hasDestination` is `false`.
+	 *
+	 * @since 0.0.0
+	 */
+	FILL_RECT,
+
+	/**
+	 * `SDL_RenderCopy` of `texture`, from `source` to `destination`, each
+	 * being the whole area when not set.
+	 *
+	 * @since 0.0.0
+	 */
+	COPY,
+
+	/**
+	 * `SDL_RenderGeometry` of `texture`, with a range of the vertices and
+	 * indices of the command buffer.
+	 *
+	 * @since 0.0.0
+	 */
+	GEOMETRY
+};
+
+/**
+ * A deferred call to the SDL renderer.
+ *
+ * @since 0.0.0
+ */
+struct RenderCommand
+{
+	RENDER_COMMAND type = RENDER_COMMAND::CLEAR;
+
+	SDL_Texture *texture = nullptr;
+
+	SDL_Rect source {0, 0, 0, 0};
+
+	SDL_Rect destination {0, 0, 0, 0};
+
+	bool hasSource = false;
+
+	bool hasDestination = false;
+
+	SDL_Color color {0, 0, 0, 0};
+
+	SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+
+	/**
+	 * The range of vertices of a `GEOMETRY` command. Its indices are relative
+	 * to `vertex`.
+	 */
+	std::size_t vertex = 0, vertexCount = 0;
+
+	/**
+	 * The range of indices of a `GEOMETRY` command.
+	 */
+	std::size_t index = 0, indexCount = 0;
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,427 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_TYPES_RENDERPACKET_HPP
+#define ZEN_RENDERER_TYPES_RENDERPACKET_HPP
+
+#include <SDL2/SDL.h>
+#include <array>
+#include <vector>
+#include <cstddef>
+
+#include "../../ecs/entity.hpp"
+#include "../../components/transform_matrix.hpp"
+#include "../../structs/types/transform_matrix_array.hpp"
+
+namespace Zen {
+
+/**
+ * The kind of a draw record.
+ *
+ * @since 0.0.0
+ */
+enum class RENDER_RECORD {
+	/**
+	 * A textured quad, fully described by the render packet.
+	 *
+	 * @since 0.0.0
+	 */
+	SPRITE,
+
+	/**
+	 * A Text Game Object, drawn by the Text Manager.
+	 *
+	 * @since 0.0.0
+	 */
+	TEXT,
+
+	/**
+	 * A rectangle mask. Its quad is computed like the one of a sprite, but it
+	 * is never drawn: its bounds become the clip rectangle.
+	 *
+	 * @since 0.0.0
+	 */
+	RECT
+};
+
+/**
+ * Bit flags of `RenderPacket::flips`.
+ *
+ * @since 0.0.0
+ */
+enum RENDER_FLIP : Uint8 {
+	RENDER_FLIP_NONE = 0,
+	RENDER_FLIP_X = 1 << 0,
+	RENDER_FLIP_Y = 1 << 1
+};
+
+/**
+ * Everything the Renderer needs to draw a Camera, extracted from the registry
+ * once per frame.
+ *
+ * The draw records are stored as a structure of arrays, where the record `i`
+ * is made of the `i`-th element of every vector. The first `count` records
+ * are drawn in order, or in `order` if set. The records after them are
+ * masks, only drawn when a record references them through `masks`.
+ *
+ * @since 0.0.0
+ */
+struct RenderPacket
+{
+	/**
+	 * The Camera this packet was extracted for.
+	 *
+	 * @since 0.0.0
+	 */
+	Entity camera = entt::null;
+
+	/**
+	 * Whether the Camera viewport is outside of the window, in which case
+	 * nothing is drawn.
+	 *
+	 * @since 0.0.0
+	 */
+	bool skip = false;
+
+	/**
+	 * Whether the renderer must be clipped to `viewport`.
+	 *
+	 * @since 0.0.0
+	 */
+	bool clip = false;
+
+	/**
+	 * The viewport of the Camera, in window space.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Rect viewport {0, 0, 0, 0};
+
+	/**
+	 * Whether the Camera has no background to fill.
+	 *
+	 * @since 0.0.0
+	 */
+	bool transparent = true;
+
+	/**
+	 * The background color of the Camera, with the Camera alpha applied.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Color background {0, 0, 0, 0};
+
+	/**
+	 * Whether records entirely outside of `viewport` are culled.
+	 *
+	 * @since 0.0.0
+	 */
+	bool cull = false;
+
+	/**
+	 * The display scale of the Scale Manager at the time of the extraction.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_FPoint displayScale {1.f, 1.f};
+
+	/**
+	 * The display offset of the Scale Manager at the time of the extraction.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_FPoint displayOffset {0.f, 0.f};
+
+	/**
+	 * The view matrices the records are drawn with. The first one is the
+	 * matrix of the Camera, the others are the Camera matrix combined with the
+	 * matrix of a parent container.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Components::TransformMatrix> viewMatrices;
+
+	/**
+	 * The index of the record masking the whole Camera, or `-1`.
+	 *
+	 * @since 0.0.0
+	 */
+	int mask = -1;
+
+	/**
+	 * The number of records to draw, in order.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t count = 0;
+
+	/**
+	 * The kind of each record.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<RENDER_RECORD> kinds;
+
+	/**
+	 * The Game Object each record was extracted from. Only text records need
+	 * it to be drawn.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entity> entities;
+
+	/**
+	 * The SDL texture to sample from.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SDL_Texture*> textures;
+
+	/**
+	 * The source rectangle in the texture, in normalized coordinates: u0, v0,
+	 * u1, v1. Flips are not applied.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::array<float, 4>> uvs;
+
+	/**
+	 * The size of the quad, in the local space of the Game Object.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SDL_FPoint> sizes;
+
+	/**
+	 * The translation of the quad, relative to its view. The origin and the
+	 * scroll are already applied.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<double> translateX, translateY;
+
+	/**
+	 * The rotation of the quad, in radians.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<double> rotation;
+
+	/**
+	 * The scale of the quad.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<double> scaleX, scaleY;
+
+	/**
+	 * The index of the view matrix of each record in `viewMatrices`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<int> views;
+
+	/**
+	 * The matrix taking the quad from the local space of the Game Object to
+	 * the Camera space. The display scale of the Scale Manager is not applied.
+	 *
+	 * Computed by `Renderer::prepare`.
+	 *
+	 * @since 0.0.0
+	 */
+	TransformMatrixArray matrices;
+
+	/**
+	 * The four corners of each quad in window space, in the order: top-left,
+	 * top-right, bottom-right, bottom-left. The corners of the record `i`
+	 * start at `i * 4`.
+	 *
+	 * Computed by `Renderer::prepare`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SDL_FPoint> quads;
+
+	/**
+	 * Whether the record is entirely outside of the Camera viewport.
+	 *
+	 * Computed by `Renderer::prepare`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Uint8> culled;
+
+	/**
+	 * The tint of each corner, in the order: top-left, top-right,
+	 * bottom-right, bottom-left.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::array<int, 4>> tints;
+
+	/**
+	 * The alpha of each corner, with the Camera alpha applied, in the same
+	 * order as `tints`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::array<float, 4>> alphas;
+
+	/**
+	 * The SDL blend mode to draw with.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SDL_BlendMode> blendModes;
+
+	/**
+	 * A combination of `RENDER_FLIP` flags.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Uint8> flips;
+
+	/**
+	 * The index of the record masking this one, or `-1`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<int> masks;
+
+	/**
+	 * Whether the texture frame of the record is fully opaque.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Uint8> opaque;
+
+	/**
+	 * The order the first `count` records are drawn in, set by
+	 * `Renderer::sortRecords`. Empty, they are drawn in index order.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::size_t> order;
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The total number of records, masks included.
+	 */
+	std::size_t size () const
+	{
+		return kinds.size();
+	}
+
+	/**
+	 * Removes every record, keeping the allocated memory.
+	 *
+	 * @since 0.0.0
+	 */
+	void clear ()
+	{
+		camera = entt::null;
+		skip = false;
+		clip = false;
+		transparent = true;
+		cull = false;
+		mask = -1;
+		count = 0;
+
+		viewMatrices.clear();
+		kinds.clear();
+		entities.clear();
+		textures.clear();
+		uvs.clear();
+		sizes.clear();
+		translateX.clear();
+		translateY.clear();
+		rotation.clear();
+		scaleX.clear();
+		scaleY.clear();
+		views.clear();
+		matrices.clear();
+		quads.clear();
+		culled.clear();
+		tints.clear();
+		alphas.clear();
+		blendModes.clear();
+		flips.clear();
+		masks.clear();
+		opaque.clear();
+		order.clear();
+	}
+
+	/**
+	 * Appends a record with default values.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param kind_ The kind of the record.
+	 * @param entity_ The Game Object the record is extracted from.
+	 *
+	 * @return The index of the new record.
+	 */
+	std::size_t add (RENDER_RECORD kind_, Entity entity_)
+	{
+		kinds.emplace_back(kind_);
+		entities.emplace_back(entity_);
+		textures.emplace_back(nullptr);
+		uvs.push_back({0.f, 0.f, 1.f, 1.f});
+		sizes.push_back({0.f, 0.f});
+		translateX.emplace_back(0.);
+		translateY.emplace_back(0.);
+		rotation.emplace_back(0.);
+		scaleX.emplace_back(1.);
+		scaleY.emplace_back(1.);
+		views.emplace_back(0);
+		matrices.resize(matrices.size() + 1);
+		quads.resize(quads.size() + 4);
+		culled.emplace_back(0);
+		tints.push_back({0xffffff, 0xffffff, 0xffffff, 0xffffff});
+		alphas.push_back({1.f, 1.f, 1.f, 1.f});
+		blendModes.emplace_back(SDL_BLENDMODE_BLEND);
+		flips.emplace_back(RENDER_FLIP_NONE);
+		masks.emplace_back(-1);
+		opaque.emplace_back(0);
+
+		return kinds.size() - 1;
+	}
+
+	/**
+	 * Removes the last record.
+	 *
+	 * @since 0.0.0
+	 */
+	void pop ()
+	{
+		kinds.pop_back();
+		entities.pop_back();
+		textures.pop_back();
+		uvs.pop_back();
+		sizes.pop_back();
+		translateX.pop_back();
+		translateY.pop_back();
+		rotation.pop_back();
+		scaleX.pop_back();
+		scaleY.pop_back();
+		views.pop_back();
+		matrices.resize(matrices.size() - 1);
+		quads.resize(quads.size() - 4);
+		culled.pop_back();
+		tints.pop_back();
+		alphas.pop_back();
+		blendModes.pop_back();
+		flips.pop_back();
+		masks.pop_back();
+		opaque.pop_back();
+	}
+};
+
+}	// namespace Zen
+
+#endif
@@ -22,6 +22,8 @@ void ScaleManager::boot (GameConfig *cfg)
 
 	parseConfig();
 
+	updateRenderSize();
+
 	startListeners();
 }
 
@@ -57,6 +59,7 @@ void ScaleManager::refresh ()
 {
 	updateScale();
 	updateOffset();
+	updateRenderSize();
 }
 
 void ScaleManager::updateScale ()
@@ -90,6 +93,28 @@ void ScaleManager::updateOffset ()
 	}
 }
 
+void ScaleManager::updateRenderSize ()
+{
+	if (!config->internalResolution)
+	{
+		renderWidth = 0;
+		renderHeight = 0;
+		renderScale = displayScale;
+		renderOffset = displayOffset;
+
+		return;
+	}
+
+	// Default to the game size, drawn without any scaling
+	renderWidth = config->internalWidth > 0 ? config->internalWidth : static_cast<int>(gameSize.width);
+	renderHeight = config->internalHeight > 0 ? config->internalHeight : static_cast<int>(gameSize.height);
+
+	renderScale.x = static_cast<double>(renderWidth) / gameSize.width;
+	renderScale.y = static_cast<double>(renderHeight) / gameSize.height;
+	renderOffset.x = 0.;
+	renderOffset.y = 0.;
+}
+
 int ScaleManager::transformX (int windowX_)
 {
 	return (windowX_ - displayOffset.x) / displayScale.x;
@@ -122,6 +147,9 @@ void ScaleManager::onResize (int width_, int height_)
 
 		Resize(&gameSize, width_, height_);
 
+		// The internal resolution may follow the game size
+		updateRenderSize();
+
 		emit("resize", gameSize, displaySize, previousWidth_, previousHeight_);
 	}
 	else
@@ -90,6 +90,41 @@ public:
 	 */
 	Math::Vector2 displayOffset {0.0, 0.0};
 
+	/**
+	 * The scale factor between the gameSize and the render target the
+	 * Cameras draw to.
+	 *
+	 * This is `displayScale`, unless the game renders at an internal
+	 * resolution, see `GameConfig::setInternalResolution`. The Pointer keeps
+	 * using `displayScale`, as the internal render target is upscaled to the
+	 * same area of the window.
+	 *
+	 * @since 0.0.0
+	 */
+	Math::Vector2 renderScale {1.0, 1.0};
+
+	/**
+	 * The offset of the game view in the render target the Cameras draw to.
+	 *
+	 * This is `displayOffset`, or zero at an internal resolution.
+	 *
+	 * @since 0.0.0
+	 */
+	Math::Vector2 renderOffset {0.0, 0.0};
+
+	/**
+	 * The size of the internal render target, or `0` if the Cameras draw
+	 * directly to the window.
+	 *
+	 * @since 0.0.0
+	 */
+	int renderWidth = 0;
+
+	/**
+	 * @since 0.0.0
+	 */
+	int renderHeight = 0;
+
 	/* TODO
 	 * The current device orientation.
 	 *
@@ -140,6 +175,14 @@ public:
 
 	void updateOffset ();
 
+	/**
+	 * Computes the size of the internal render target, and the scale and
+	 * offset the Cameras draw with.
+	 *
+	 * @since 0.0.0
+	 */
+	void updateRenderSize ();
+
 	void startListeners ();
 
 	void stopListeners ();
@@ -9,6 +9,7 @@
 
 #include "../utils/messages.hpp"
 #include "config.hpp"
+#include "../systems/dirty.hpp"
 
 namespace Zen {
 
@@ -100,6 +101,9 @@ void SceneManager::processQueue ()
 	if (pendingLength_ == 0 && queueLength_ == 0)
 		return;
 
+	// Scenes are added, started or moved, the next frame changes
+	MarkFrameDirty();
+
 	if (pendingLength_)
 	{
 		for (auto entry_ = pending.begin(); entry_ != pending.end(); entry_++)
@@ -261,23 +265,20 @@ void SceneManager::bootScene (Scene *scene_)
 
 	scene_->preload();
 
-	/*
-	 * TODO loader progress, maybe if I make something BIG later...
-	if (scene->load.list.empty())
+	if (scene_->load.list.empty())
 	{
-		create(scene);
+		scene_->load.start();
+
+		create(scene_);
 	}
 	else
 	{
-		scene->sys.settings.status = SCENE::LOADING;
+		settings_.status = SCENE::LOADING;
 
-		scene->load.once("load_complete", &SceneManager::loadComplete, this);
+		scene_->load.once("load_complete", &SceneManager::loadComplete, this);
 
-		scene->load.start();
+		scene_->load.start();
 	}
-	*/
-
-	create(scene_);
 }
 
 void SceneManager::loadComplete (Scene* scene_)
@@ -286,10 +287,18 @@ void SceneManager::loadComplete (Scene* scene_)
 		create(scene_);
 }
 
-void SceneManager::update (Uint32 time_, Uint32 delta_)
+void SceneManager::updateLoaders ()
 {
-	processQueue();
+	for (auto& scene_ : scenes)
+	{
+		// A loading Scene isn't created yet, only its files are handled
+		if (scene_->sys.settings.status == SCENE::LOADING)
+			scene_->load.update();
+	}
+}
 
+void SceneManager::update (Uint32 time_, Uint32 delta_)
+{
 	isProcessing = true;
 
 	// Loop through the active scenes in reverse order
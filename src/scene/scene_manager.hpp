@@ -203,7 +203,16 @@ public:
 	void loadComplete (Scene* scene_);
 
 	/**
-	 * Updates the scenes.
+	 * Handles the files of the loading Scenes, and creates the ones done
+	 * loading. Runs on the main thread.
+	 *
+	 * @since 0.0.0
+	 */
+	void updateLoaders ();
+
+	/**
+	 * Steps the systems of the running Scenes. The operations queue and the
+	 * loaders are handled before, by `processQueue` and `updateLoaders`.
 	 *
 	 * @since 0.0.0
 	 *
@@ -50,6 +50,9 @@ void SceneSystems::render ()
 
 	events.emit("pre-render");
 
+	// Bring the static layers up to date before they are drawn
+	g_renderer.renderLayers(*scene);
+
 	scene->cameras.render(g_renderer, scene->children);
 
 	events.emit("render");
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_STRUCTS_TRANSFORMMATRIXARRAY_HPP
+#define ZEN_STRUCTS_TRANSFORMMATRIXARRAY_HPP
+
+#include <vector>
+#include <cstddef>
+
+#include "../../components/transform_matrix.hpp"
+
+namespace Zen {
+
+/**
+ * Many transform matrices stored as a structure of arrays, one array per
+ * component, so that batches of them can be processed with SIMD
+ * instructions.
+ *
+ * See `Components::TransformMatrix` for the meaning of each component.
+ *
+ * @struct TransformMatrixArray
+ * @since 0.0.0
+ */
+struct TransformMatrixArray
+{
+	std::vector<double> a, b, c, d, e, f;
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The number of matrices.
+	 */
+	std::size_t size () const
+	{
+		return a.size();
+	}
+
+	/**
+	 * Resizes every component array. New matrices are identities.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param size_ The new number of matrices.
+	 */
+	void resize (std::size_t size_)
+	{
+		a.resize(size_, 1.);
+		b.resize(size_, 0.);
+		c.resize(size_, 0.);
+		d.resize(size_, 1.);
+		e.resize(size_, 0.);
+		f.resize(size_, 0.);
+	}
+
+	/**
+	 * Removes every matrix, keeping the allocated memory.
+	 *
+	 * @since 0.0.0
+	 */
+	void clear ()
+	{
+		a.clear();
+		b.clear();
+		c.clear();
+		d.clear();
+		e.clear();
+		f.clear();
+	}
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param index_ The index of the matrix.
+	 *
+	 * @return A copy of the matrix at the given index.
+	 */
+	Components::TransformMatrix get (std::size_t index_) const
+	{
+		return {a[index_], b[index_], c[index_], d[index_], e[index_], f[index_]};
+	}
+
+	/**
+	 * Replaces the matrix at the given index.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param index_ The index of the matrix.
+	 * @param matrix_ The new matrix.
+	 */
+	void set (std::size_t index_, const Components::TransformMatrix& matrix_)
+	{
+		a[index_] = matrix_.a;
+		b[index_] = matrix_.b;
+		c[index_] = matrix_.c;
+		d[index_] = matrix_.d;
+		e[index_] = matrix_.e;
+		f[index_] = matrix_.f;
+	}
+};
+
+}	// namespace Zen
+
+#endif
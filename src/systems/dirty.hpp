@@ -16,6 +16,45 @@ bool IsDirty (Entity entity);
 
 void SetDirty (Entity entity, bool value);
 
+/**
+ * Flags a Game Object as changed: sets its `Dirty` component, if it has one,
+ * invalidates the static layer it belongs to, if any, and flags the frame as
+ * changed.
+ *
+ * The setters of the components affecting how a Game Object is drawn call
+ * this.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Game Object that changed.
+ */
+void MarkDirty (Entity entity);
+
+/**
+ * Flags the next frame as different from the last one drawn.
+ *
+ * When `GameConfig::renderOnChange` is set, frames nothing flagged aren't
+ * rendered. The setters, the input, the Display Lists, the Tween Managers and
+ * the Scene Manager call this. Call it after editing a component directly.
+ *
+ * @since 0.0.0
+ */
+void MarkFrameDirty ();
+
+/**
+ * @since 0.0.0
+ *
+ * @return Whether something changed since the last frame was rendered.
+ */
+bool IsFrameDirty ();
+
+/**
+ * @since 0.0.0
+ *
+ * @param value Whether the next frame must be rendered.
+ */
+void SetFrameDirty (bool value);
+
 }	// namespace Zen
 
 #endif
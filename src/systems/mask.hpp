@@ -9,6 +9,7 @@
 #define ZEN_SYSTEMS_MASK_HPP
 
 #include "../ecs/entity.hpp"
+#include "../geom/types/rectangle.hpp"
 
 namespace Zen {
 
@@ -16,6 +17,33 @@ Entity GetMask (Entity entity);
 
 void SetMask (Entity entity, Entity maskEntity, bool fixedPosition = false);
 
+/**
+ * Masks a Game Object or a Camera with an axis-aligned rectangle.
+ *
+ * This is much cheaper than a Game Object mask: the rectangle becomes the
+ * clip rectangle of the renderer, nothing is drawn offscreen. The rectangle
+ * follows the Camera scroll and zoom, but not its rotation, its bounds are
+ * used instead.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Game Object or Camera to mask.
+ * @param x The left side of the rectangle, in world space.
+ * @param y The top side of the rectangle, in world space.
+ * @param width The width of the rectangle.
+ * @param height The height of the rectangle.
+ */
+void SetRectMask (Entity entity, double x, double y, double width, double height);
+
+/**
+ * @since 0.0.0
+ *
+ * @param entity The masked Game Object or Camera.
+ *
+ * @return The rectangle mask, empty if there is none.
+ */
+Rectangle GetRectMask (Entity entity);
+
 void ClearMask (Entity entity);
 
 }	// namespace Zen
@@ -0,0 +1,92 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_SYSTEMS_RENDERCACHE_HPP
+#define ZEN_SYSTEMS_RENDERCACHE_HPP
+
+#include <SDL2/SDL_types.h>
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * Renders a Camera once every few frames. The last render is drawn on the
+ * frames in between.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Camera.
+ * @param frames The number of frames between two renders. `1` renders every
+ * frame.
+ */
+void SetRenderInterval (Entity entity, int frames);
+
+int GetRenderInterval (Entity entity);
+
+/**
+ * Renders a Camera a given number of times per second, whatever the frame
+ * rate of the game.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Camera.
+ * @param rate The number of renders per second. `0` follows the render
+ * interval instead.
+ */
+void SetRenderRate (Entity entity, double rate);
+
+double GetRenderRate (Entity entity);
+
+/**
+ * Renders a Camera into a texture smaller than its viewport, which is then
+ * stretched over the viewport.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Camera.
+ * @param scale The size of the texture relative to the viewport, clamped
+ * between 0.05 and 1.
+ */
+void SetResolutionScale (Entity entity, double scale);
+
+double GetResolutionScale (Entity entity);
+
+/**
+ * Forces a Camera with a render cache to be rendered on the next frame.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Camera.
+ */
+void InvalidateRenderCache (Entity entity);
+
+/**
+ * Advances the render cache of a Camera by one frame.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Camera.
+ * @param time The current time, in milliseconds.
+ *
+ * @return `true` if the Camera must be rendered on this frame, `false` if
+ * its cached texture can be drawn instead.
+ */
+bool UpdateRenderCache (Entity entity, Uint32 time);
+
+/**
+ * Removes the render cache of a Camera and frees its texture. The Camera is
+ * rendered every frame, at full resolution, again.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Camera.
+ */
+void RemoveRenderCache (Entity entity);
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,37 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_SYSTEMS_RENDERTEXTURE_HPP
+#define ZEN_SYSTEMS_RENDERTEXTURE_HPP
+
+#include <string>
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * @since 0.0.0
+ *
+ * @param entity The Render Texture.
+ *
+ * @return The key of its texture in the Texture Manager.
+ */
+std::string GetRenderTextureKey (Entity entity);
+
+/**
+ * Removes the texture of a Render Texture from the Texture Manager and
+ * destroys it. The entity itself is left to the caller.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Render Texture.
+ */
+void RemoveRenderTexture (Entity entity);
+
+}	// namespace Zen
+
+#endif
@@ -6,6 +6,7 @@
  */
 
 #include "../alpha.hpp"
+#include "../dirty.hpp"
 
 #include "../../math/clamp.hpp"
 #include "../../utils/assert.hpp"
@@ -44,6 +45,8 @@ void SetAlpha (Entity entity, double topLeft, double topRight, double bottomLeft
 			// Turn the alpha bit to 1
 			renderable->flags |= FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 double GetAlpha (Entity entity)
@@ -108,6 +111,8 @@ void SetAlpha (Entity entity, double value)
 			// Turn the alpha bit to 1
 			renderable->flags |= FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetAlphaTopLeft (Entity entity, double value)
@@ -125,6 +130,8 @@ void SetAlphaTopLeft (Entity entity, double value)
 			// Turn the alpha bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetAlphaTopRight (Entity entity, double value)
@@ -142,6 +149,8 @@ void SetAlphaTopRight (Entity entity, double value)
 			// Turn the alpha bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetAlphaBottomLeft (Entity entity, double value)
@@ -159,6 +168,8 @@ void SetAlphaBottomLeft (Entity entity, double value)
 			// Turn the alpha bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetAlphaBottomRight (Entity entity, double value)
@@ -176,6 +187,8 @@ void SetAlphaBottomRight (Entity entity, double value)
 			// Turn the alpha bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 }	// namespace Zen
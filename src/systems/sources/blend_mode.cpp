@@ -6,6 +6,7 @@
  */
 
 #include "../blend_mode.hpp"
+#include "../dirty.hpp"
 
 #include "../../utils/assert.hpp"
 #include "../../components/blend_mode.hpp"
@@ -28,6 +29,8 @@ void SetBlendMode (Entity entity, BLEND_MODE value)
 	ZEN_ASSERT(blendMode, "The entity has no 'BlendMode' component.");
 
 	blendMode->value = value;
+
+	MarkDirty(entity);
 }
 
 BLEND_MODE blendMode = BLEND_MODE::NORMAL;
@@ -12,9 +12,9 @@
 #include "../../math/clamp.hpp"
 #include "../../geom/rectangle.hpp"
 #include "../../components/bounds.hpp"
-#include "../../components/dirty.hpp"
 #include "../../components/scroll.hpp"
 #include "../size.hpp"
+#include "../dirty.hpp"
 
 namespace Zen {
 
@@ -24,18 +24,14 @@ void SetBounds (Entity entity, double x, double y, double width, double height)
 {
 	g_registry.emplace_or_replace<Components::Bounds>(entity, Rectangle {x, y, width, height});
 
-	auto dirty = g_registry.try_get<Components::Dirty>(entity);
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 void RemoveBounds (Entity entity)
 {
 	g_registry.remove_if_exists<Components::Bounds>(entity);
 
-	auto dirty = g_registry.try_get<Components::Dirty>(entity);
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 Rectangle GetBounds (Entity entity)
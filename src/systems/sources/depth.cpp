@@ -9,6 +9,7 @@
 
 #include "../../utils/assert.hpp"
 #include "../../components/depth.hpp"
+#include "../dirty.hpp"
 
 namespace Zen {
 
@@ -28,6 +29,8 @@ void SetDepth (Entity entity, int value)
 	ZEN_ASSERT(depth, "The entity has no 'Depth' component.");
 
 	depth->value = value;
+
+	MarkDirty(entity);
 }
 
 }	// namespace Zen
@@ -9,11 +9,18 @@
 
 #include "../../utils/assert.hpp"
 #include "../../components/dirty.hpp"
+#include "../../components/static_layer.hpp"
 
 namespace Zen {
 
 extern entt::registry g_registry;
 
+/**
+ * Whether something changed since the last frame was rendered. The first
+ * frame is always rendered.
+ */
+static bool frameDirty = true;
+
 bool IsDirty (Entity entity)
 {
 	auto dirty = g_registry.try_get<Components::Dirty>(entity);
@@ -28,6 +35,40 @@ void SetDirty (Entity entity, bool value)
 	ZEN_ASSERT(dirty, "The entity has no 'Dirty' component.");
 
 	dirty->value = value;
+
+	if (value)
+		frameDirty = true;
+}
+
+void MarkDirty (Entity entity)
+{
+	auto [dirty, member] = g_registry.try_get<Components::Dirty, Components::LayerMember>(entity);
+
+	if (dirty)
+		dirty->value = true;
+
+	frameDirty = true;
+
+	if (member)
+	{
+		if (auto layer = g_registry.try_get<Components::StaticLayer>(member->layer))
+			layer->dirty = true;
+	}
+}
+
+void MarkFrameDirty ()
+{
+	frameDirty = true;
+}
+
+bool IsFrameDirty ()
+{
+	return frameDirty;
+}
+
+void SetFrameDirty (bool value)
+{
+	frameDirty = value;
 }
 
 }	// namespace Zen
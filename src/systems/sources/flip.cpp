@@ -6,6 +6,7 @@
  */
 
 #include "../flip.hpp"
+#include "../dirty.hpp"
 
 #include "../../components/flip.hpp"
 #include "../../utils/assert.hpp"
@@ -20,6 +21,8 @@ void ToggleFlipX (Entity entity)
 	ZEN_ASSERT(flip, "The entity has no 'Flip' component.");
 
 	flip->x = !flip->x;
+
+	MarkDirty(entity);
 }
 
 void ToggleFlipY (Entity entity)
@@ -28,6 +31,8 @@ void ToggleFlipY (Entity entity)
 	ZEN_ASSERT(flip, "The entity has no 'Flip' component.");
 
 	flip->y = !flip->y;
+
+	MarkDirty(entity);
 }
 
 void SetFlipX (Entity entity, bool value)
@@ -36,6 +41,8 @@ void SetFlipX (Entity entity, bool value)
 	ZEN_ASSERT(flip, "The entity has no 'Flip' component.");
 
 	flip->x = value;
+
+	MarkDirty(entity);
 }
 
 void SetFlipY (Entity entity, bool value)
@@ -44,6 +51,8 @@ void SetFlipY (Entity entity, bool value)
 	ZEN_ASSERT(flip, "The entity has no 'Flip' component.");
 
 	flip->y = value;
+
+	MarkDirty(entity);
 }
 
 void SetFlip (Entity entity, bool x, bool y)
@@ -53,6 +62,8 @@ void SetFlip (Entity entity, bool x, bool y)
 
 	flip->x = x;
 	flip->y = y;
+
+	MarkDirty(entity);
 }
 
 void ResetFlip (Entity entity)
@@ -62,6 +73,8 @@ void ResetFlip (Entity entity)
 
 	flip->x = false;
 	flip->y = false;
+
+	MarkDirty(entity);
 }
 
 bool GetFlipX (Entity entity)
@@ -9,6 +9,7 @@
 
 #include "../../components/mask.hpp"
 #include "../../utils/assert.hpp"
+#include "../dirty.hpp"
 
 namespace Zen {
 
@@ -29,6 +30,29 @@ void SetMask (Entity entity, Entity maskEntity, bool fixedPosition)
 
 	mask->mask = maskEntity;
 	mask->fixed = fixedPosition;
+	mask->rect = Rectangle();
+
+	MarkDirty(entity);
+}
+
+void SetRectMask (Entity entity, double x, double y, double width, double height)
+{
+	auto mask = g_registry.try_get<Components::Mask>(entity);
+	ZEN_ASSERT(mask, "The entity has no 'Mask' component.");
+
+	mask->mask = entt::null;
+	mask->fixed = false;
+	mask->rect = Rectangle(x, y, width, height);
+
+	MarkDirty(entity);
+}
+
+Rectangle GetRectMask (Entity entity)
+{
+	auto mask = g_registry.try_get<Components::Mask>(entity);
+	ZEN_ASSERT(mask, "The entity has no 'Mask' component.");
+
+	return mask->rect;
 }
 
 void ClearMask (Entity entity)
@@ -38,6 +62,9 @@ void ClearMask (Entity entity)
 
 	mask->mask = entt::null;
 	mask->fixed = false;
+	mask->rect = Rectangle();
+
+	MarkDirty(entity);
 }
 
 }	// namespace Zen
@@ -6,12 +6,14 @@
  */
 
 #include "../origin.hpp"
+#include "../dirty.hpp"
 
 #include "../../utils/assert.hpp"
 
 #include "../../components/size.hpp"
 #include "../../components/textured.hpp"
 #include "../../components/origin.hpp"
+#include "../../components/update.hpp"
 
 #include "../../texture/components/frame.hpp"
 
@@ -21,31 +23,46 @@ extern entt::registry g_registry;
 
 void SetDisplayOriginX (Entity entity, int value)
 {
-	auto [origin, size] = g_registry.try_get<Components::Origin, Components::Size>(entity);
+	auto [origin, size, update] = g_registry.try_get<Components::Origin, Components::Size, Components::Update<Components::Origin>>(entity);
 	ZEN_ASSERT(origin && size, "The entity has no 'Origin' or 'Size' component.");
 
 	origin->displayX = value;
 	origin->x = value / size->width;
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetDisplayOriginY (Entity entity, int value)
 {
-	auto [origin, size] = g_registry.try_get<Components::Origin, Components::Size>(entity);
+	auto [origin, size, update] = g_registry.try_get<Components::Origin, Components::Size, Components::Update<Components::Origin>>(entity);
 	ZEN_ASSERT(origin && size, "The entity has no 'Origin' or 'Size' component.");
 
 	origin->displayY = value;
 	origin->y = value / size->height;
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetDisplayOrigin (Entity entity, int x, int y)
 {
-	auto [origin, size] = g_registry.try_get<Components::Origin, Components::Size>(entity);
+	auto [origin, size, update] = g_registry.try_get<Components::Origin, Components::Size, Components::Update<Components::Origin>>(entity);
 	ZEN_ASSERT(origin && size, "The entity has no 'Origin' or 'Size' component.");
 
 	origin->displayX = x;
 	origin->displayY = y;
 	origin->x = x / size->width;
 	origin->y = y / size->height;
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetDisplayOrigin (Entity entity, int value = 0)
@@ -55,7 +72,7 @@ void SetDisplayOrigin (Entity entity, int value = 0)
 
 void SetOrigin (Entity entity, double x, double y)
 {
-	auto [origin, size] = g_registry.try_get<Components::Origin, Components::Size>(entity);
+	auto [origin, size, update] = g_registry.try_get<Components::Origin, Components::Size, Components::Update<Components::Origin>>(entity);
 	ZEN_ASSERT(origin, "The entity has no 'Origin' component.");
 
 	origin->x = x;
@@ -67,6 +84,11 @@ void SetOrigin (Entity entity, double x, double y)
 		origin->displayX = origin->x * size->width;
 		origin->displayY = origin->y * size->height;
 	}
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetOrigin (Entity entity, double value)
@@ -76,9 +98,11 @@ void SetOrigin (Entity entity, double value)
 
 void SetOriginFromFrame (Entity entity)
 {
-	auto [origin, size, textured] = g_registry.try_get<Components::Origin, Components::Size, Components::Textured>(entity);
+	auto [origin, size, textured, update] = g_registry.try_get<Components::Origin, Components::Size, Components::Textured, Components::Update<Components::Origin>>(entity);
 	ZEN_ASSERT(origin && size, "The entity has no 'Origin', 'Size' or 'Textured' component.");
 
+	MarkDirty(entity);
+
 	// Get texture
 	auto& frame = g_registry.get<Components::Frame>(textured->frame);
 
@@ -96,6 +120,9 @@ void SetOriginFromFrame (Entity entity)
 	// Update display origin
 	origin->displayX = origin->x * size->width;
 	origin->displayY = origin->y * size->height;
+
+	if (update)
+		update->update(entity);
 }
 
 double GetOriginX (Entity entity)
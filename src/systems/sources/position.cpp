@@ -6,6 +6,7 @@
  */
 
 #include "../position.hpp"
+#include "../dirty.hpp"
 
 #include "../../components/position.hpp"
 #include "../../components/update.hpp"
@@ -21,13 +22,18 @@ extern ScaleManager g_scale;
 
 void SetPosition (Entity entity, double x, double y, double z, double w)
 {
-	auto position = g_registry.try_get<Components::Position>(entity);
+	auto [position, update] = g_registry.try_get<Components::Position, Components::Update<Components::Position>>(entity);
 	ZEN_ASSERT(position, "The entity has no 'Position' component.");
 
 	position->x = x;
 	position->y = y;
 	position->z = z;
 	position->w = w;
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetPosition (Entity entity, Math::Vector2 source)
@@ -51,7 +57,7 @@ void SetPosition (Entity entity, Math::Vector2 source)
 
 void SetRandomPosition (Entity entity, double x, double y, double width, double height)
 {
-	auto position = g_registry.try_get<Components::Position>(entity);
+	auto [position, update] = g_registry.try_get<Components::Position, Components::Update<Components::Position>>(entity);
 	ZEN_ASSERT(position, "The entity has no 'Position' component.");
 
 	if (width == 0)
@@ -62,6 +68,11 @@ void SetRandomPosition (Entity entity, double x, double y, double width, double
 
 	position->x = Math::Random.between(x, width);
 	position->y = Math::Random.between(y, height);
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetX (Entity entity, double value)
@@ -73,6 +84,8 @@ void SetX (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetY (Entity entity, double value)
@@ -84,6 +97,8 @@ void SetY (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetZ (Entity entity, double value)
@@ -95,6 +110,8 @@ void SetZ (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetW (Entity entity, double value)
@@ -106,6 +123,8 @@ void SetW (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 double GetX (Entity entity)
@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "../render_cache.hpp"
+
+#include "../../utils/assert.hpp"
+#include "../../math/clamp.hpp"
+#include "../../components/render_cache.hpp"
+#include "../../renderer/renderer.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+extern Renderer g_renderer;
+
+void SetRenderInterval (Entity entity, int frames)
+{
+	auto& cache = g_registry.get_or_emplace<Components::RenderCache>(entity);
+
+	cache.interval = (frames > 1) ? frames : 1;
+	cache.valid = false;
+}
+
+int GetRenderInterval (Entity entity)
+{
+	auto cache = g_registry.try_get<Components::RenderCache>(entity);
+
+	return cache ? cache->interval : 1;
+}
+
+void SetRenderRate (Entity entity, double rate)
+{
+	auto& cache = g_registry.get_or_emplace<Components::RenderCache>(entity);
+
+	cache.rate = (rate > 0.) ? rate : 0.;
+	cache.valid = false;
+}
+
+double GetRenderRate (Entity entity)
+{
+	auto cache = g_registry.try_get<Components::RenderCache>(entity);
+
+	return cache ? cache->rate : 0.;
+}
+
+void SetResolutionScale (Entity entity, double scale)
+{
+	auto& cache = g_registry.get_or_emplace<Components::RenderCache>(entity);
+
+	cache.resolution = Math::Clamp(scale, 0.05, 1.);
+	cache.valid = false;
+}
+
+double GetResolutionScale (Entity entity)
+{
+	auto cache = g_registry.try_get<Components::RenderCache>(entity);
+
+	return cache ? cache->resolution : 1.;
+}
+
+void InvalidateRenderCache (Entity entity)
+{
+	auto cache = g_registry.try_get<Components::RenderCache>(entity);
+
+	if (cache)
+		cache->valid = false;
+}
+
+bool UpdateRenderCache (Entity entity, Uint32 time)
+{
+	auto cache = g_registry.try_get<Components::RenderCache>(entity);
+	ZEN_ASSERT(cache, "The entity has no 'RenderCache' component.");
+
+	cache->frames++;
+
+	bool due = !cache->valid;
+
+	if (cache->rate > 0.)
+		due = due || (time - cache->time) >= 1000. / cache->rate;
+	else
+		due = due || cache->frames >= cache->interval;
+
+	if (due)
+	{
+		cache->frames = 0;
+		cache->time = time;
+	}
+
+	return due;
+}
+
+void RemoveRenderCache (Entity entity)
+{
+	auto cache = g_registry.try_get<Components::RenderCache>(entity);
+
+	if (!cache)
+		return;
+
+	if (cache->texture)
+		g_renderer.destroyTexture(cache->texture);
+
+	g_registry.remove<Components::RenderCache>(entity);
+}
+
+}	// namespace Zen
@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "../render_texture.hpp"
+
+#include "../../utils/assert.hpp"
+#include "../../components/render_texture.hpp"
+#include "../../texture/texture_manager.hpp"
+#include "../../texture/systems/texture.hpp"
+#include "../../texture/systems/source.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+extern TextureManager g_texture;
+
+std::string GetRenderTextureKey (Entity entity)
+{
+	auto renderTexture = g_registry.try_get<Components::RenderTexture>(entity);
+	ZEN_ASSERT(renderTexture, "The entity has no 'RenderTexture' component.");
+
+	return renderTexture->key;
+}
+
+void RemoveRenderTexture (Entity entity)
+{
+	auto renderTexture = g_registry.try_get<Components::RenderTexture>(entity);
+
+	if (!renderTexture || !renderTexture->texture)
+		return;
+
+	// The source destroys the SDL texture
+	if (g_texture.exists(renderTexture->key))
+		g_texture.remove(renderTexture->key);
+
+	renderTexture->texture = nullptr;
+	renderTexture->width = renderTexture->height = 0;
+}
+
+}	// namespace Zen
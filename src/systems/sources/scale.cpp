@@ -6,10 +6,12 @@
  */
 
 #include "../scale.hpp"
+#include "../dirty.hpp"
 
 #include "../../utils/assert.hpp"
 #include "../../components/scale.hpp"
 #include "../../components/renderable.hpp"
+#include "../../components/update.hpp"
 
 #define FLAG 0b0100
 
@@ -19,12 +21,17 @@ extern entt::registry g_registry;
 
 void SetScale (Entity entity, double value)
 {
-	auto [scale, renderable] = g_registry.try_get<Components::Scale, Components::Renderable>(entity);
+	auto [scale, renderable, update] = g_registry.try_get<Components::Scale, Components::Renderable, Components::Update<Components::Scale>>(entity);
 	ZEN_ASSERT(scale, "The entity has no 'Scale' component.");
 
+	MarkDirty(entity);
+
 	scale->x = value;
 	scale->y = value;
 
+	if (update)
+		update->update(entity);
+
 	if (!renderable) return;
 
 	if (value == 0)
@@ -49,11 +56,16 @@ double GetScale (Entity entity)
 
 void SetScaleX (Entity entity, double value)
 {
-	auto [scale, renderable] = g_registry.try_get<Components::Scale, Components::Renderable>(entity);
+	auto [scale, renderable, update] = g_registry.try_get<Components::Scale, Components::Renderable, Components::Update<Components::Scale>>(entity);
 	ZEN_ASSERT(scale, "The entity has no 'Scale' component.");
 
+	MarkDirty(entity);
+
 	scale->x = value;
 
+	if (update)
+		update->update(entity);
+
 	if (!renderable) return;
 
 	if (value == 0)
@@ -78,11 +90,16 @@ double GetScaleX (Entity entity)
 
 void SetScaleY (Entity entity, double value)
 {
-	auto [scale, renderable] = g_registry.try_get<Components::Scale, Components::Renderable>(entity);
+	auto [scale, renderable, update] = g_registry.try_get<Components::Scale, Components::Renderable, Components::Update<Components::Scale>>(entity);
 	ZEN_ASSERT(scale, "The entity has no 'Scale' component.");
 
+	MarkDirty(entity);
+
 	scale->y = value;
 
+	if (update)
+		update->update(entity);
+
 	if (!renderable) return;
 
 	if (value == 0)
@@ -10,11 +10,11 @@
 #include "../../utils/assert.hpp"
 #include "../../geom/rectangle.hpp"
 #include "../../components/scroll.hpp"
-#include "../../components/dirty.hpp"
 #include "../../components/bounds.hpp"
 #include "../../components/size.hpp"
 #include "../../components/mid_point.hpp"
 #include "../bounds.hpp"
+#include "../dirty.hpp"
 
 namespace Zen {
 
@@ -22,36 +22,43 @@ extern entt::registry g_registry;
 
 void SetScrollX (Entity entity, double value)
 {
-	auto [scroll, dirty] = g_registry.try_get<Components::Scroll, Components::Dirty>(entity);
+	auto scroll = g_registry.try_get<Components::Scroll>(entity);
 	ZEN_ASSERT(scroll, "The entity has no 'Scroll' component.");
 
+	// The Camera sets its scroll every frame, even when following nothing
+	if (scroll->x == value)
+		return;
+
 	scroll->x = value;
 
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 void SetScrollY (Entity entity, double value)
 {
-	auto [scroll, dirty] = g_registry.try_get<Components::Scroll, Components::Dirty>(entity);
+	auto scroll = g_registry.try_get<Components::Scroll>(entity);
 	ZEN_ASSERT(scroll, "The entity has no 'Scroll' component.");
 
+	if (scroll->y == value)
+		return;
+
 	scroll->y = value;
 
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 void SetScroll (Entity entity, double x, double y)
 {
-	auto [scroll, dirty] = g_registry.try_get<Components::Scroll, Components::Dirty>(entity);
+	auto scroll = g_registry.try_get<Components::Scroll>(entity);
 	ZEN_ASSERT(scroll, "The entity has no 'Scroll' component.");
 
+	if (scroll->x == x && scroll->y == y)
+		return;
+
 	scroll->x = x;
 	scroll->y = y;
 
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 void SetScroll (Entity entity, double value)
@@ -6,9 +6,11 @@
  */
 
 #include "../scroll_factor.hpp"
+#include "../dirty.hpp"
 
 #include "../../utils/assert.hpp"
 #include "../../components/scroll_factor.hpp"
+#include "../../components/update.hpp"
 
 namespace Zen {
 
@@ -16,11 +18,16 @@ extern entt::registry g_registry;
 
 void SetScrollFactor (Entity entity, double x, double y)
 {
-	auto scrollFactor = g_registry.try_get<Components::ScrollFactor>(entity);
+	auto [scrollFactor, update] = g_registry.try_get<Components::ScrollFactor, Components::Update<Components::ScrollFactor>>(entity);
 	ZEN_ASSERT(scrollFactor, "The entity has no 'ScrollFactor' component.");
 
 	scrollFactor->x = x;
 	scrollFactor->y = y;
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetScrollFactor (Entity entity, double value)
@@ -6,6 +6,7 @@
  */
 
 #include "../size.hpp"
+#include "../dirty.hpp"
 
 #include <cmath>
 #include "../../utils/assert.hpp"
@@ -65,31 +66,43 @@ double GetDisplayHeight (Entity entity)
 
 void SetDisplayWidth (Entity entity, double value)
 {
-	auto [scale, textured] = g_registry.try_get<Components::Scale, Components::Textured>(entity);
+	auto [scale, textured, update] = g_registry.try_get<Components::Scale, Components::Textured, Components::Update<Components::Scale>>(entity);
 	ZEN_ASSERT(scale && textured, "The entity has no 'Scale' or 'Textured' component.");
 
 	// Get frame
 	auto frame = g_registry.get<Components::Frame>(textured->frame);
 
 	scale->x = value / frame.data.sourceSize.width;
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetDisplayHeight (Entity entity, double value)
 {
-	auto [scale, textured] = g_registry.try_get<Components::Scale, Components::Textured>(entity);
+	auto [scale, textured, update] = g_registry.try_get<Components::Scale, Components::Textured, Components::Update<Components::Scale>>(entity);
 	ZEN_ASSERT(scale && textured, "The entity has no 'Scale' or 'Textured' component.");
 
 	// Get frame
 	auto frame = g_registry.get<Components::Frame>(textured->frame);
 
 	scale->y = value / frame.data.sourceSize.height;
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetSizeToFrame (Entity entity, Entity frame)
 {
-	auto [size, textured] = g_registry.try_get<Components::Size, Components::Textured>(entity);
+	auto [size, textured, update] = g_registry.try_get<Components::Size, Components::Textured, Components::Update<Components::Size>>(entity);
 	ZEN_ASSERT(size && textured, "The entity has no 'Size' or 'Textured' component.");
 
+	MarkDirty(entity);
+
 	Components::Frame *fr;
 
 	if (frame == entt::null && textured->frame == entt::null)
@@ -110,6 +123,9 @@ void SetSizeToFrame (Entity entity, Entity frame)
 
 	size->width = fr->data.sourceSize.width;
 	size->height = fr->data.sourceSize.height;
+
+	if (update)
+		update->update(entity);
 }
 
 void SetSize (Entity entity, double width, double height)
@@ -122,6 +138,8 @@ void SetSize (Entity entity, double width, double height)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetSize (Entity entity, double value)
@@ -131,7 +149,7 @@ void SetSize (Entity entity, double value)
 
 void SetDisplaySize (Entity entity, double width, double height)
 {
-	auto [scale, textured] = g_registry.try_get<Components::Scale, Components::Textured>(entity);
+	auto [scale, textured, update] = g_registry.try_get<Components::Scale, Components::Textured, Components::Update<Components::Scale>>(entity);
 	ZEN_ASSERT(scale && textured, "The entity has no 'Scale' or 'Textured' component.");
 
 	// Get frame
@@ -139,6 +157,11 @@ void SetDisplaySize (Entity entity, double width, double height)
 
 	scale->x = width / frame.data.sourceSize.width;
 	scale->y = height / frame.data.sourceSize.height;
+
+	if (update)
+		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetWidth (Entity entity, double value)
@@ -150,6 +173,8 @@ void SetWidth (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetHeight (Entity entity, double value)
@@ -161,6 +186,8 @@ void SetHeight (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 double GetWidth (Entity entity)
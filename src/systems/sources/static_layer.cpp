@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "../static_layer.hpp"
+
+#include <algorithm>
+#include "../../utils/assert.hpp"
+#include "../../components/static_layer.hpp"
+#include "../../components/renderable.hpp"
+#include "../../cameras/2d/systems/camera.hpp"
+#include "../render_texture.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+void AddToLayer (Entity layer, Entity entity)
+{
+	auto staticLayer = g_registry.try_get<Components::StaticLayer>(layer);
+	ZEN_ASSERT(staticLayer, "The entity has no 'StaticLayer' component.");
+
+	auto renderable = g_registry.try_get<Components::Renderable>(entity);
+	ZEN_ASSERT(renderable, "The entity has no 'Renderable' component.");
+
+	if (auto member = g_registry.try_get<Components::LayerMember>(entity))
+	{
+		if (member->layer == layer)
+			return;
+
+		RemoveFromLayer(entity);
+	}
+
+	g_registry.emplace<Components::LayerMember>(entity, layer, renderable->filter);
+
+	// Every Scene Camera ignores it, the layer Camera has no ID and still
+	// renders it
+	renderable->filter = ~0;
+
+	staticLayer->members.emplace_back(entity);
+	staticLayer->dirty = true;
+}
+
+void RemoveFromLayer (Entity entity)
+{
+	auto member = g_registry.try_get<Components::LayerMember>(entity);
+
+	if (!member)
+		return;
+
+	if (auto staticLayer = g_registry.try_get<Components::StaticLayer>(member->layer))
+	{
+		auto& members = staticLayer->members;
+		members.erase(std::remove(members.begin(), members.end(), entity), members.end());
+
+		staticLayer->dirty = true;
+	}
+
+	if (auto renderable = g_registry.try_get<Components::Renderable>(entity))
+		renderable->filter = member->filter;
+
+	g_registry.remove<Components::LayerMember>(entity);
+}
+
+const std::vector<Entity>& GetLayerMembers (Entity layer)
+{
+	auto staticLayer = g_registry.try_get<Components::StaticLayer>(layer);
+	ZEN_ASSERT(staticLayer, "The entity has no 'StaticLayer' component.");
+
+	return staticLayer->members;
+}
+
+void InvalidateLayer (Entity layer)
+{
+	auto staticLayer = g_registry.try_get<Components::StaticLayer>(layer);
+	ZEN_ASSERT(staticLayer, "The entity has no 'StaticLayer' component.");
+
+	staticLayer->dirty = true;
+}
+
+bool IsLayerDirty (Entity layer)
+{
+	auto staticLayer = g_registry.try_get<Components::StaticLayer>(layer);
+	ZEN_ASSERT(staticLayer, "The entity has no 'StaticLayer' component.");
+
+	return staticLayer->dirty;
+}
+
+void RemoveStaticLayer (Entity layer)
+{
+	auto staticLayer = g_registry.try_get<Components::StaticLayer>(layer);
+
+	if (!staticLayer)
+		return;
+
+	// Copied, as removing a member edits the list
+	auto members = staticLayer->members;
+	for (auto member : members)
+		RemoveFromLayer(member);
+
+	if (g_registry.valid(staticLayer->camera))
+		DestroyCamera(staticLayer->camera);
+
+	RemoveRenderTexture(layer);
+
+	g_registry.remove<Components::StaticLayer>(layer);
+}
+
+}	// namespace Zen
@@ -12,6 +12,7 @@
 #include "../../utils/messages.hpp"
 #include "../../components/text.hpp"
 #include "../../text/text_manager.hpp"
+#include "../dirty.hpp"
 
 namespace Zen {
 
@@ -28,6 +29,8 @@ void SetText (Entity entity, std::string content)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->text = content;
 
 	g_text.scanText(entity);
@@ -38,6 +41,8 @@ void SetTextStyle (Entity entity, TextStyle style)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style = style;
 }
 
@@ -46,6 +51,8 @@ void SetFontFamily(Entity entity, std::string fontFamily)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.fontFamily = fontFamily;
 }
 
@@ -54,6 +61,8 @@ void SetTextColor (Entity entity, int color)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.color = color;
 }
 
@@ -67,6 +76,8 @@ void SetFontSize (Entity entity, int size)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.fontSize = size;
 }
 
@@ -75,6 +86,8 @@ void SetTextDecoration (Entity entity, TEXT_DECORATION decoration)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.decoration = decoration;
 }
 
@@ -83,6 +96,8 @@ void SetTextOutline (Entity entity, int outlineWidth)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.outline = outlineWidth;
 }
 
@@ -91,6 +106,8 @@ void SetTextPadding (Entity entity, int padding)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.paddingTop = padding;
 	text->style.paddingBottom = padding;
 	text->style.paddingLeft = padding;
@@ -102,6 +119,8 @@ void SetTextPaddingTop (Entity entity, int padding)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.paddingTop = padding;
 }
 
@@ -110,6 +129,8 @@ void SetTextPaddingBottom (Entity entity, int padding)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.paddingBottom = padding;
 }
 
@@ -118,6 +139,8 @@ void SetTextPaddingLeft (Entity entity, int padding)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.paddingLeft = padding;
 }
 
@@ -126,6 +149,8 @@ void SetTextPaddingRight (Entity entity, int padding)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.paddingRight = padding;
 }
 
@@ -134,6 +159,8 @@ void SetTextWrapWidth (Entity entity, int width)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.wrapWidth = width;
 }
 
@@ -142,6 +169,8 @@ void SetTextAdvancedWrap (Entity entity, bool advanced)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.advancedWrap = advanced;
 }
 
@@ -150,6 +179,8 @@ void SetTextAlign (Entity entity, TEXT_ALIGNMENT alignment)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.alignment = alignment;
 }
 
@@ -158,6 +189,8 @@ void SetTextBackgroundColor (Entity entity, int color)
 	auto text = g_registry.try_get<Components::Text>(entity);
 	ZEN_ASSERT(text, "The entity has no 'Text' component");
 
+	MarkDirty(entity);
+
 	text->style.backgroundColor = color;
 }
 
@@ -6,6 +6,7 @@
  */
 
 #include "../textured.hpp"
+#include "../dirty.hpp"
 
 #include "../../utils/assert.hpp"
 #include "../../texture/texture_manager.hpp"
@@ -52,6 +53,8 @@ void SetCrop (Entity entity, int x, int y, int width, int height)
 
 		textured->isCropped = true;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetCrop (Entity entity, Rectangle rect)
@@ -90,6 +93,8 @@ void SetFrame (Entity entity, std::string frameName, bool updateSize, bool updat
 
 	ZEN_ASSERT(textured && renderable, "The entity has no 'Textured' or 'Renderable' component.");
 
+	MarkDirty(entity);
+
 	textured->frame = GetFrame(textured->texture, frameName);
 
 	Components::Frame *frame;
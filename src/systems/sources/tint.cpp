@@ -6,6 +6,7 @@
  */
 
 #include "../tint.hpp"
+#include "../dirty.hpp"
 
 #include "../../components/tint.hpp"
 #include "../../utils/assert.hpp"
@@ -44,6 +45,8 @@ void SetTint (Entity entity, int topLeft, int topRight, int bottomLeft, int bott
 	}
 
 	tint->fill = false;
+
+	MarkDirty(entity);
 }
 
 void SetTintFill (Entity entity, int topLeft, int topRight, int bottomLeft, int bottomRight)
@@ -51,6 +54,8 @@ void SetTintFill (Entity entity, int topLeft, int topRight, int bottomLeft, int
 	SetTint(entity, topLeft, topRight, bottomLeft, bottomRight);
 
 	g_registry.get<Components::Tint>(entity).fill = true;
+
+	MarkDirty(entity);
 }
 
 Color GetTint (Entity entity)
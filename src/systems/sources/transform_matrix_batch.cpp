@@ -0,0 +1,641 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "../transform_matrix_batch.hpp"
+
+#include <atomic>
+#include <cmath>
+#include "../../math/const.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ZEN_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace Zen {
+
+/**
+ * Detects the best instruction set supported by the CPU.
+ *
+ * @since 0.0.0
+ */
+static SIMD_LEVEL DetectSimdLevel ()
+{
+#ifdef ZEN_SIMD_X86
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+		return SIMD_LEVEL::AVX2;
+
+	if (__builtin_cpu_supports("sse2"))
+		return SIMD_LEVEL::SSE2;
+#endif
+
+	return SIMD_LEVEL::SCALAR;
+}
+
+/**
+ * The best instruction set supported by the CPU.
+ *
+ * @since 0.0.0
+ */
+static SIMD_LEVEL SupportedSimdLevel ()
+{
+	static const SIMD_LEVEL level = DetectSimdLevel();
+
+	return level;
+}
+
+/**
+ * The instruction set the batch functions are using. It can be set while
+ * workers are running batches, which read it once per call.
+ *
+ * @since 0.0.0
+ */
+static std::atomic<SIMD_LEVEL>& CurrentSimdLevel ()
+{
+	static std::atomic<SIMD_LEVEL> level {SupportedSimdLevel()};
+
+	return level;
+}
+
+SIMD_LEVEL GetSimdLevel ()
+{
+	return CurrentSimdLevel().load(std::memory_order_relaxed);
+}
+
+SIMD_LEVEL SetSimdLevel (SIMD_LEVEL level)
+{
+	if (static_cast<int>(level) > static_cast<int>(SupportedSimdLevel()))
+		level = SupportedSimdLevel();
+
+	CurrentSimdLevel().store(level, std::memory_order_relaxed);
+
+	return level;
+}
+
+// Scalar kernels, also used for the tail of the SIMD ones
+
+static void MultiplyLhsScalar (
+		const Components::TransformMatrix& l,
+		TransformMatrixArray *m,
+		std::size_t begin,
+		std::size_t end)
+{
+	for (std::size_t i = begin; i < end; i++)
+	{
+		double sa = m->a[i], sb = m->b[i], sc = m->c[i];
+		double sd = m->d[i], se = m->e[i], sf = m->f[i];
+
+		m->a[i] = (sa * l.a) + (sb * l.c);
+		m->b[i] = (sa * l.b) + (sb * l.d);
+		m->c[i] = (sc * l.a) + (sd * l.c);
+		m->d[i] = (sc * l.b) + (sd * l.d);
+		m->e[i] = (se * l.a) + (sf * l.c) + l.e;
+		m->f[i] = (se * l.b) + (sf * l.d) + l.f;
+	}
+}
+
+static void MultiplyPairsScalar (
+		TransformMatrixArray *m,
+		const TransformMatrixArray& s,
+		std::size_t begin,
+		std::size_t end)
+{
+	for (std::size_t i = begin; i < end; i++)
+	{
+		double la = m->a[i], lb = m->b[i], lc = m->c[i];
+		double ld = m->d[i], le = m->e[i], lf = m->f[i];
+
+		m->a[i] = (s.a[i] * la) + (s.b[i] * lc);
+		m->b[i] = (s.a[i] * lb) + (s.b[i] * ld);
+		m->c[i] = (s.c[i] * la) + (s.d[i] * lc);
+		m->d[i] = (s.c[i] * lb) + (s.d[i] * ld);
+		m->e[i] = (s.e[i] * la) + (s.f[i] * lc) + le;
+		m->f[i] = (s.e[i] * lb) + (s.f[i] * ld) + lf;
+	}
+}
+
+/**
+ * Decomposes a single matrix, like `DecomposeMatrix`.
+ *
+ * @since 0.0.0
+ */
+static void DecomposeOne (
+		double a, double b, double c, double d, double e, double f,
+		DecomposedMatrix *output)
+{
+	double determinant = a * d - b * c;
+
+	output->translateX = e;
+	output->translateY = f;
+
+	if (a || b)
+	{
+		double r = std::sqrt(a * a + b * b);
+
+		output->rotation = (b > 0) ? std::acos(a / r) : -std::acos(a / r);
+		output->scaleX = r;
+		output->scaleY = determinant / r;
+	}
+	else if (c || d)
+	{
+		double s = std::sqrt(c * c + d * d);
+
+		output->rotation = M_PI * 0.5 - (d > 0 ? std::acos(-c / s) : -std::acos(c / s));
+		output->scaleX = determinant / s;
+		output->scaleY = s;
+	}
+	else
+	{
+		output->rotation = 0.;
+		output->scaleX = 0.;
+		output->scaleY = 0.;
+	}
+}
+
+static void DecomposeScalar (
+		const TransformMatrixArray& m,
+		DecomposedMatrix *output,
+		std::size_t begin,
+		std::size_t end)
+{
+	for (std::size_t i = begin; i < end; i++)
+		DecomposeOne(m.a[i], m.b[i], m.c[i], m.d[i], m.e[i], m.f[i], &output[i]);
+}
+
+static void TransformQuadsScalar (
+		const TransformMatrixArray& m,
+		const SDL_FPoint *sizes,
+		SDL_FPoint scale,
+		SDL_FPoint offset,
+		SDL_FPoint *quads,
+		std::size_t begin,
+		std::size_t end)
+{
+	for (std::size_t i = begin; i < end; i++)
+	{
+		double w = sizes[i].x;
+		double h = sizes[i].y;
+
+		double wa = w * m.a[i], wb = w * m.b[i];
+		double hc = h * m.c[i], hd = h * m.d[i];
+
+		SDL_FPoint *q = quads + i * 4;
+
+		q[0].x = m.e[i] * scale.x + offset.x;
+		q[0].y = m.f[i] * scale.y + offset.y;
+		q[1].x = (wa + m.e[i]) * scale.x + offset.x;
+		q[1].y = (wb + m.f[i]) * scale.y + offset.y;
+		q[2].x = (wa + hc + m.e[i]) * scale.x + offset.x;
+		q[2].y = (wb + hd + m.f[i]) * scale.y + offset.y;
+		q[3].x = (hc + m.e[i]) * scale.x + offset.x;
+		q[3].y = (hd + m.f[i]) * scale.y + offset.y;
+	}
+}
+
+#ifdef ZEN_SIMD_X86
+
+// SSE2 kernels, two matrices at a time
+
+__attribute__((target("sse2")))
+static void MultiplyLhsSse2 (
+		const Components::TransformMatrix& l,
+		TransformMatrixArray *m,
+		std::size_t begin,
+		std::size_t end)
+{
+	const __m128d la = _mm_set1_pd(l.a), lb = _mm_set1_pd(l.b);
+	const __m128d lc = _mm_set1_pd(l.c), ld = _mm_set1_pd(l.d);
+	const __m128d le = _mm_set1_pd(l.e), lf = _mm_set1_pd(l.f);
+
+	std::size_t i = begin;
+	for (; i + 2 <= end; i += 2)
+	{
+		__m128d sa = _mm_loadu_pd(&m->a[i]), sb = _mm_loadu_pd(&m->b[i]);
+		__m128d sc = _mm_loadu_pd(&m->c[i]), sd = _mm_loadu_pd(&m->d[i]);
+		__m128d se = _mm_loadu_pd(&m->e[i]), sf = _mm_loadu_pd(&m->f[i]);
+
+		_mm_storeu_pd(&m->a[i], _mm_add_pd(_mm_mul_pd(sa, la), _mm_mul_pd(sb, lc)));
+		_mm_storeu_pd(&m->b[i], _mm_add_pd(_mm_mul_pd(sa, lb), _mm_mul_pd(sb, ld)));
+		_mm_storeu_pd(&m->c[i], _mm_add_pd(_mm_mul_pd(sc, la), _mm_mul_pd(sd, lc)));
+		_mm_storeu_pd(&m->d[i], _mm_add_pd(_mm_mul_pd(sc, lb), _mm_mul_pd(sd, ld)));
+		_mm_storeu_pd(&m->e[i], _mm_add_pd(_mm_add_pd(_mm_mul_pd(se, la), _mm_mul_pd(sf, lc)), le));
+		_mm_storeu_pd(&m->f[i], _mm_add_pd(_mm_add_pd(_mm_mul_pd(se, lb), _mm_mul_pd(sf, ld)), lf));
+	}
+
+	MultiplyLhsScalar(l, m, i, end);
+}
+
+__attribute__((target("sse2")))
+static void MultiplyPairsSse2 (
+		TransformMatrixArray *m,
+		const TransformMatrixArray& s,
+		std::size_t begin,
+		std::size_t end)
+{
+	std::size_t i = begin;
+	for (; i + 2 <= end; i += 2)
+	{
+		__m128d la = _mm_loadu_pd(&m->a[i]), lb = _mm_loadu_pd(&m->b[i]);
+		__m128d lc = _mm_loadu_pd(&m->c[i]), ld = _mm_loadu_pd(&m->d[i]);
+		__m128d le = _mm_loadu_pd(&m->e[i]), lf = _mm_loadu_pd(&m->f[i]);
+		__m128d sa = _mm_loadu_pd(&s.a[i]), sb = _mm_loadu_pd(&s.b[i]);
+		__m128d sc = _mm_loadu_pd(&s.c[i]), sd = _mm_loadu_pd(&s.d[i]);
+		__m128d se = _mm_loadu_pd(&s.e[i]), sf = _mm_loadu_pd(&s.f[i]);
+
+		_mm_storeu_pd(&m->a[i], _mm_add_pd(_mm_mul_pd(sa, la), _mm_mul_pd(sb, lc)));
+		_mm_storeu_pd(&m->b[i], _mm_add_pd(_mm_mul_pd(sa, lb), _mm_mul_pd(sb, ld)));
+		_mm_storeu_pd(&m->c[i], _mm_add_pd(_mm_mul_pd(sc, la), _mm_mul_pd(sd, lc)));
+		_mm_storeu_pd(&m->d[i], _mm_add_pd(_mm_mul_pd(sc, lb), _mm_mul_pd(sd, ld)));
+		_mm_storeu_pd(&m->e[i], _mm_add_pd(_mm_add_pd(_mm_mul_pd(se, la), _mm_mul_pd(sf, lc)), le));
+		_mm_storeu_pd(&m->f[i], _mm_add_pd(_mm_add_pd(_mm_mul_pd(se, lb), _mm_mul_pd(sf, ld)), lf));
+	}
+
+	MultiplyPairsScalar(m, s, i, end);
+}
+
+__attribute__((target("sse2")))
+static void DecomposeSse2 (
+		const TransformMatrixArray& m,
+		DecomposedMatrix *output,
+		std::size_t begin,
+		std::size_t end)
+{
+	const __m128d zero = _mm_setzero_pd();
+
+	std::size_t i = begin;
+	for (; i + 2 <= end; i += 2)
+	{
+		__m128d a = _mm_loadu_pd(&m.a[i]), b = _mm_loadu_pd(&m.b[i]);
+		__m128d c = _mm_loadu_pd(&m.c[i]), d = _mm_loadu_pd(&m.d[i]);
+
+		// Matrices with no a and b component take the rare path
+		int degenerate = _mm_movemask_pd(_mm_and_pd(
+					_mm_cmpeq_pd(a, zero), _mm_cmpeq_pd(b, zero)));
+
+		__m128d r = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(a, a), _mm_mul_pd(b, b)));
+		__m128d det = _mm_sub_pd(_mm_mul_pd(a, d), _mm_mul_pd(b, c));
+		__m128d cosine = _mm_div_pd(a, r);
+		__m128d scaleY = _mm_div_pd(det, r);
+
+		double rs[2], cosines[2], scalesY[2];
+		_mm_storeu_pd(rs, r);
+		_mm_storeu_pd(cosines, cosine);
+		_mm_storeu_pd(scalesY, scaleY);
+
+		for (int k = 0; k < 2; k++)
+		{
+			if (degenerate & (1 << k))
+			{
+				DecomposeOne(m.a[i + k], m.b[i + k], m.c[i + k], m.d[i + k],
+						m.e[i + k], m.f[i + k], &output[i + k]);
+				continue;
+			}
+
+			auto& o = output[i + k];
+			o.translateX = m.e[i + k];
+			o.translateY = m.f[i + k];
+			o.rotation = (m.b[i + k] > 0) ? std::acos(cosines[k]) : -std::acos(cosines[k]);
+			o.scaleX = rs[k];
+			o.scaleY = scalesY[k];
+		}
+	}
+
+	DecomposeScalar(m, output, i, end);
+}
+
+__attribute__((target("sse2")))
+static void TransformQuadsSse2 (
+		const TransformMatrixArray& m,
+		const SDL_FPoint *sizes,
+		SDL_FPoint scale,
+		SDL_FPoint offset,
+		SDL_FPoint *quads,
+		std::size_t begin,
+		std::size_t end)
+{
+	const __m128d sx = _mm_set1_pd(scale.x), sy = _mm_set1_pd(scale.y);
+	const __m128d ox = _mm_set1_pd(offset.x), oy = _mm_set1_pd(offset.y);
+
+	std::size_t i = begin;
+	for (; i + 2 <= end; i += 2)
+	{
+		__m128d w = _mm_set_pd(sizes[i + 1].x, sizes[i].x);
+		__m128d h = _mm_set_pd(sizes[i + 1].y, sizes[i].y);
+
+		__m128d e = _mm_loadu_pd(&m.e[i]), f = _mm_loadu_pd(&m.f[i]);
+		__m128d wa = _mm_mul_pd(w, _mm_loadu_pd(&m.a[i]));
+		__m128d wb = _mm_mul_pd(w, _mm_loadu_pd(&m.b[i]));
+		__m128d hc = _mm_mul_pd(h, _mm_loadu_pd(&m.c[i]));
+		__m128d hd = _mm_mul_pd(h, _mm_loadu_pd(&m.d[i]));
+
+		__m128d xs[4] {
+			e,
+			_mm_add_pd(wa, e),
+			_mm_add_pd(_mm_add_pd(wa, hc), e),
+			_mm_add_pd(hc, e)
+		};
+		__m128d ys[4] {
+			f,
+			_mm_add_pd(wb, f),
+			_mm_add_pd(_mm_add_pd(wb, hd), f),
+			_mm_add_pd(hd, f)
+		};
+
+		for (int k = 0; k < 4; k++)
+		{
+			double x[2], y[2];
+			_mm_storeu_pd(x, _mm_add_pd(_mm_mul_pd(xs[k], sx), ox));
+			_mm_storeu_pd(y, _mm_add_pd(_mm_mul_pd(ys[k], sy), oy));
+
+			quads[i * 4 + k] = {static_cast<float>(x[0]), static_cast<float>(y[0])};
+			quads[(i + 1) * 4 + k] = {static_cast<float>(x[1]), static_cast<float>(y[1])};
+		}
+	}
+
+	TransformQuadsScalar(m, sizes, scale, offset, quads, i, end);
+}
+
+// AVX2 kernels, four matrices at a time
+
+__attribute__((target("avx2")))
+static void MultiplyLhsAvx2 (
+		const Components::TransformMatrix& l,
+		TransformMatrixArray *m,
+		std::size_t begin,
+		std::size_t end)
+{
+	const __m256d la = _mm256_set1_pd(l.a), lb = _mm256_set1_pd(l.b);
+	const __m256d lc = _mm256_set1_pd(l.c), ld = _mm256_set1_pd(l.d);
+	const __m256d le = _mm256_set1_pd(l.e), lf = _mm256_set1_pd(l.f);
+
+	std::size_t i = begin;
+	for (; i + 4 <= end; i += 4)
+	{
+		__m256d sa = _mm256_loadu_pd(&m->a[i]), sb = _mm256_loadu_pd(&m->b[i]);
+		__m256d sc = _mm256_loadu_pd(&m->c[i]), sd = _mm256_loadu_pd(&m->d[i]);
+		__m256d se = _mm256_loadu_pd(&m->e[i]), sf = _mm256_loadu_pd(&m->f[i]);
+
+		_mm256_storeu_pd(&m->a[i], _mm256_add_pd(_mm256_mul_pd(sa, la), _mm256_mul_pd(sb, lc)));
+		_mm256_storeu_pd(&m->b[i], _mm256_add_pd(_mm256_mul_pd(sa, lb), _mm256_mul_pd(sb, ld)));
+		_mm256_storeu_pd(&m->c[i], _mm256_add_pd(_mm256_mul_pd(sc, la), _mm256_mul_pd(sd, lc)));
+		_mm256_storeu_pd(&m->d[i], _mm256_add_pd(_mm256_mul_pd(sc, lb), _mm256_mul_pd(sd, ld)));
+		_mm256_storeu_pd(&m->e[i], _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(se, la), _mm256_mul_pd(sf, lc)), le));
+		_mm256_storeu_pd(&m->f[i], _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(se, lb), _mm256_mul_pd(sf, ld)), lf));
+	}
+
+	MultiplyLhsSse2(l, m, i, end);
+}
+
+__attribute__((target("avx2")))
+static void MultiplyPairsAvx2 (
+		TransformMatrixArray *m,
+		const TransformMatrixArray& s,
+		std::size_t begin,
+		std::size_t end)
+{
+	std::size_t i = begin;
+	for (; i + 4 <= end; i += 4)
+	{
+		__m256d la = _mm256_loadu_pd(&m->a[i]), lb = _mm256_loadu_pd(&m->b[i]);
+		__m256d lc = _mm256_loadu_pd(&m->c[i]), ld = _mm256_loadu_pd(&m->d[i]);
+		__m256d le = _mm256_loadu_pd(&m->e[i]), lf = _mm256_loadu_pd(&m->f[i]);
+		__m256d sa = _mm256_loadu_pd(&s.a[i]), sb = _mm256_loadu_pd(&s.b[i]);
+		__m256d sc = _mm256_loadu_pd(&s.c[i]), sd = _mm256_loadu_pd(&s.d[i]);
+		__m256d se = _mm256_loadu_pd(&s.e[i]), sf = _mm256_loadu_pd(&s.f[i]);
+
+		_mm256_storeu_pd(&m->a[i], _mm256_add_pd(_mm256_mul_pd(sa, la), _mm256_mul_pd(sb, lc)));
+		_mm256_storeu_pd(&m->b[i], _mm256_add_pd(_mm256_mul_pd(sa, lb), _mm256_mul_pd(sb, ld)));
+		_mm256_storeu_pd(&m->c[i], _mm256_add_pd(_mm256_mul_pd(sc, la), _mm256_mul_pd(sd, lc)));
+		_mm256_storeu_pd(&m->d[i], _mm256_add_pd(_mm256_mul_pd(sc, lb), _mm256_mul_pd(sd, ld)));
+		_mm256_storeu_pd(&m->e[i], _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(se, la), _mm256_mul_pd(sf, lc)), le));
+		_mm256_storeu_pd(&m->f[i], _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(se, lb), _mm256_mul_pd(sf, ld)), lf));
+	}
+
+	MultiplyPairsSse2(m, s, i, end);
+}
+
+__attribute__((target("avx2")))
+static void DecomposeAvx2 (
+		const TransformMatrixArray& m,
+		DecomposedMatrix *output,
+		std::size_t begin,
+		std::size_t end)
+{
+	const __m256d zero = _mm256_setzero_pd();
+
+	std::size_t i = begin;
+	for (; i + 4 <= end; i += 4)
+	{
+		__m256d a = _mm256_loadu_pd(&m.a[i]), b = _mm256_loadu_pd(&m.b[i]);
+		__m256d c = _mm256_loadu_pd(&m.c[i]), d = _mm256_loadu_pd(&m.d[i]);
+
+		// Matrices with no a and b component take the rare path
+		int degenerate = _mm256_movemask_pd(_mm256_and_pd(
+					_mm256_cmp_pd(a, zero, _CMP_EQ_OQ),
+					_mm256_cmp_pd(b, zero, _CMP_EQ_OQ)));
+
+		__m256d r = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(a, a), _mm256_mul_pd(b, b)));
+		__m256d det = _mm256_sub_pd(_mm256_mul_pd(a, d), _mm256_mul_pd(b, c));
+		__m256d cosine = _mm256_div_pd(a, r);
+		__m256d scaleY = _mm256_div_pd(det, r);
+
+		double rs[4], cosines[4], scalesY[4];
+		_mm256_storeu_pd(rs, r);
+		_mm256_storeu_pd(cosines, cosine);
+		_mm256_storeu_pd(scalesY, scaleY);
+
+		for (int k = 0; k < 4; k++)
+		{
+			if (degenerate & (1 << k))
+			{
+				DecomposeOne(m.a[i + k], m.b[i + k], m.c[i + k], m.d[i + k],
+						m.e[i + k], m.f[i + k], &output[i + k]);
+				continue;
+			}
+
+			auto& o = output[i + k];
+			o.translateX = m.e[i + k];
+			o.translateY = m.f[i + k];
+			o.rotation = (m.b[i + k] > 0) ? std::acos(cosines[k]) : -std::acos(cosines[k]);
+			o.scaleX = rs[k];
+			o.scaleY = scalesY[k];
+		}
+	}
+
+	DecomposeSse2(m, output, i, end);
+}
+
+__attribute__((target("avx2")))
+static void TransformQuadsAvx2 (
+		const TransformMatrixArray& m,
+		const SDL_FPoint *sizes,
+		SDL_FPoint scale,
+		SDL_FPoint offset,
+		SDL_FPoint *quads,
+		std::size_t begin,
+		std::size_t end)
+{
+	const __m256d sx = _mm256_set1_pd(scale.x), sy = _mm256_set1_pd(scale.y);
+	const __m256d ox = _mm256_set1_pd(offset.x), oy = _mm256_set1_pd(offset.y);
+
+	std::size_t i = begin;
+	for (; i + 4 <= end; i += 4)
+	{
+		__m256d w = _mm256_set_pd(sizes[i + 3].x, sizes[i + 2].x, sizes[i + 1].x, sizes[i].x);
+		__m256d h = _mm256_set_pd(sizes[i + 3].y, sizes[i + 2].y, sizes[i + 1].y, sizes[i].y);
+
+		__m256d e = _mm256_loadu_pd(&m.e[i]), f = _mm256_loadu_pd(&m.f[i]);
+		__m256d wa = _mm256_mul_pd(w, _mm256_loadu_pd(&m.a[i]));
+		__m256d wb = _mm256_mul_pd(w, _mm256_loadu_pd(&m.b[i]));
+		__m256d hc = _mm256_mul_pd(h, _mm256_loadu_pd(&m.c[i]));
+		__m256d hd = _mm256_mul_pd(h, _mm256_loadu_pd(&m.d[i]));
+
+		__m256d xs[4] {
+			e,
+			_mm256_add_pd(wa, e),
+			_mm256_add_pd(_mm256_add_pd(wa, hc), e),
+			_mm256_add_pd(hc, e)
+		};
+		__m256d ys[4] {
+			f,
+			_mm256_add_pd(wb, f),
+			_mm256_add_pd(_mm256_add_pd(wb, hd), f),
+			_mm256_add_pd(hd, f)
+		};
+
+		for (int k = 0; k < 4; k++)
+		{
+			float x[4], y[4];
+			_mm_storeu_ps(x, _mm256_cvtpd_ps(_mm256_add_pd(_mm256_mul_pd(xs[k], sx), ox)));
+			_mm_storeu_ps(y, _mm256_cvtpd_ps(_mm256_add_pd(_mm256_mul_pd(ys[k], sy), oy)));
+
+			for (int j = 0; j < 4; j++)
+				quads[(i + j) * 4 + k] = {x[j], y[j]};
+		}
+	}
+
+	TransformQuadsSse2(m, sizes, scale, offset, quads, i, end);
+}
+
+#endif
+
+void ApplyITRS (
+		TransformMatrixArray *matrices,
+		const double *x,
+		const double *y,
+		const double *rotation,
+		const double *scaleX,
+		const double *scaleY,
+		std::size_t begin,
+		std::size_t end)
+{
+	// Bound by sin and cos, which have no SIMD counterpart in the standard
+	// library, so the same loop serves every level
+	for (std::size_t i = begin; i < end; i++)
+	{
+		double radianSin = std::sin(rotation[i]);
+		double radianCos = std::cos(rotation[i]);
+
+		matrices->e[i] = x[i];
+		matrices->f[i] = y[i];
+		matrices->a[i] = radianCos * scaleX[i];
+		matrices->b[i] = radianSin * scaleX[i];
+		matrices->c[i] = -radianSin * scaleY[i];
+		matrices->d[i] = radianCos * scaleY[i];
+	}
+}
+
+void Multiply (
+		const Components::TransformMatrix& lhs,
+		TransformMatrixArray *matrices,
+		std::size_t begin,
+		std::size_t end)
+{
+#ifdef ZEN_SIMD_X86
+	switch (GetSimdLevel())
+	{
+		case SIMD_LEVEL::AVX2:
+			return MultiplyLhsAvx2(lhs, matrices, begin, end);
+		case SIMD_LEVEL::SSE2:
+			return MultiplyLhsSse2(lhs, matrices, begin, end);
+		default:
+			break;
+	}
+#endif
+
+	MultiplyLhsScalar(lhs, matrices, begin, end);
+}
+
+void Multiply (
+		TransformMatrixArray *matrices,
+		const TransformMatrixArray& rhs,
+		std::size_t begin,
+		std::size_t end)
+{
+#ifdef ZEN_SIMD_X86
+	switch (GetSimdLevel())
+	{
+		case SIMD_LEVEL::AVX2:
+			return MultiplyPairsAvx2(matrices, rhs, begin, end);
+		case SIMD_LEVEL::SSE2:
+			return MultiplyPairsSse2(matrices, rhs, begin, end);
+		default:
+			break;
+	}
+#endif
+
+	MultiplyPairsScalar(matrices, rhs, begin, end);
+}
+
+void DecomposeMatrix (
+		const TransformMatrixArray& matrices,
+		DecomposedMatrix *output,
+		std::size_t begin,
+		std::size_t end)
+{
+#ifdef ZEN_SIMD_X86
+	switch (GetSimdLevel())
+	{
+		case SIMD_LEVEL::AVX2:
+			return DecomposeAvx2(matrices, output, begin, end);
+		case SIMD_LEVEL::SSE2:
+			return DecomposeSse2(matrices, output, begin, end);
+		default:
+			break;
+	}
+#endif
+
+	DecomposeScalar(matrices, output, begin, end);
+}
+
+void TransformQuads (
+		const TransformMatrixArray& matrices,
+		const SDL_FPoint *sizes,
+		SDL_FPoint scale,
+		SDL_FPoint offset,
+		SDL_FPoint *quads,
+		std::size_t begin,
+		std::size_t end)
+{
+#ifdef ZEN_SIMD_X86
+	switch (GetSimdLevel())
+	{
+		case SIMD_LEVEL::AVX2:
+			return TransformQuadsAvx2(matrices, sizes, scale, offset, quads, begin, end);
+		case SIMD_LEVEL::SSE2:
+			return TransformQuadsSse2(matrices, sizes, scale, offset, quads, begin, end);
+		default:
+			break;
+	}
+#endif
+
+	TransformQuadsScalar(matrices, sizes, scale, offset, quads, begin, end);
+}
+
+}	// namespace Zen
@@ -6,6 +6,7 @@
  */
 
 #include "../visible.hpp"
+#include "../dirty.hpp"
 
 #include "../../utils/assert.hpp"
 #include "../../components/visible.hpp"
@@ -43,6 +44,8 @@ void SetVisible (Entity entity, bool value)
 			// Turn the visibility bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 }	// namespace Zen
@@ -6,11 +6,11 @@
  */
 
 #include "../zoom.hpp"
+#include "../dirty.hpp"
 
 #include <algorithm>
 #include "../../utils/assert.hpp"
 #include "../../components/zoom.hpp"
-#include "../../components/dirty.hpp"
 
 namespace Zen {
 
@@ -18,33 +18,31 @@ extern entt::registry g_registry;
 
 void SetZoomX (Entity entity, double value)
 {
-	auto [zoom, dirty] = g_registry.try_get<Components::Zoom, Components::Dirty>(entity);
+	auto zoom = g_registry.try_get<Components::Zoom>(entity);
 	ZEN_ASSERT(zoom, "The entity has no 'Zoom' component.");
 
 	value = std::max(value, 0.001);
 
 	zoom->x = value;
 
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 void SetZoomY (Entity entity, double value)
 {
-	auto [zoom, dirty] = g_registry.try_get<Components::Zoom, Components::Dirty>(entity);
+	auto zoom = g_registry.try_get<Components::Zoom>(entity);
 	ZEN_ASSERT(zoom, "The entity has no 'Zoom' component.");
 
 	value = std::max(value, 0.001);
 
 	zoom->y = value;
 
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 void SetZoom (Entity entity, double x, double y)
 {
-	auto [zoom, dirty] = g_registry.try_get<Components::Zoom, Components::Dirty>(entity);
+	auto zoom = g_registry.try_get<Components::Zoom>(entity);
 	ZEN_ASSERT(zoom, "The entity has no 'Zoom' component.");
 
 	x = std::max(x, 0.001);
@@ -55,8 +53,7 @@ void SetZoom (Entity entity, double x, double y)
 	zoom->x = x;
 	zoom->y = y;
 
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 double GetZoomX (Entity entity)
@@ -0,0 +1,82 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_SYSTEMS_STATICLAYER_HPP
+#define ZEN_SYSTEMS_STATICLAYER_HPP
+
+#include <vector>
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * Moves a Game Object into a static layer. It is drawn after the other
+ * members of the layer, at a position relative to the top-left corner of the
+ * layer.
+ *
+ * The Game Object stays in its display list, but every Scene Camera ignores
+ * it. It is still hit by the input, at its position in the layer.
+ *
+ * @since 0.0.0
+ *
+ * @param layer The static layer.
+ * @param entity The Game Object to add. It leaves its previous layer.
+ */
+void AddToLayer (Entity layer, Entity entity);
+
+/**
+ * Moves a Game Object out of its static layer, and back to the Scene
+ * Cameras.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Game Object to remove.
+ */
+void RemoveFromLayer (Entity entity);
+
+/**
+ * @since 0.0.0
+ *
+ * @param layer The static layer.
+ *
+ * @return The members of the layer, in render order.
+ */
+const std::vector<Entity>& GetLayerMembers (Entity layer);
+
+/**
+ * Forces a static layer to be rendered again on the next frame.
+ *
+ * Members changed through their setters do this on their own.
+ *
+ * @since 0.0.0
+ *
+ * @param layer The static layer.
+ */
+void InvalidateLayer (Entity layer);
+
+/**
+ * @since 0.0.0
+ *
+ * @param layer The static layer.
+ *
+ * @return Whether the layer will be rendered again on the next frame.
+ */
+bool IsLayerDirty (Entity layer);
+
+/**
+ * Removes every member of a static layer, then destroys its Camera and its
+ * texture. The layer entity itself is left to the caller.
+ *
+ * @since 0.0.0
+ *
+ * @param layer The static layer.
+ */
+void RemoveStaticLayer (Entity layer);
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_SYSTEMS_TRANSFORMMATRIXBATCH_HPP
+#define ZEN_SYSTEMS_TRANSFORMMATRIXBATCH_HPP
+
+#include <SDL2/SDL.h>
+#include <cstddef>
+
+#include "../enums/simd_level.hpp"
+#include "../components/transform_matrix.hpp"
+#include "../structs/types/transform_matrix_array.hpp"
+#include "../structs/types/decomposed_matrix.hpp"
+
+namespace Zen {
+
+/**
+ * The batch functions of this file process the range `[begin, end)` of their
+ * arrays with the best instruction set supported by the CPU, detected the
+ * first time one of them runs. Their results are the same as calling the
+ * single matrix functions of the same name on every element.
+ *
+ * @since 0.0.0
+ *
+ * @return The instruction set currently used by the batch functions.
+ */
+SIMD_LEVEL GetSimdLevel ();
+
+/**
+ * Forces the instruction set used by the batch functions. Levels the CPU
+ * doesn't support are lowered to the best supported one.
+ *
+ * @since 0.0.0
+ *
+ * @param level The instruction set to use.
+ *
+ * @return The instruction set actually used.
+ */
+SIMD_LEVEL SetSimdLevel (SIMD_LEVEL level);
+
+/**
+ * Apply the identity, translate, rotate and scale operations on a range of
+ * matrices.
+ *
+ * This is bound by `sin` and `cos`, so it runs the same scalar code whatever
+ * the instruction set.
+ *
+ * @since 0.0.0
+ *
+ * @param matrices The matrices to write to. They must be at least `end` long.
+ * @param x The horizontal translations.
+ * @param y The vertical translations.
+ * @param rotation The angles of rotation in radians.
+ * @param scaleX The horizontal scales.
+ * @param scaleY The vertical scales.
+ * @param begin The first matrix to process.
+ * @param end One past the last matrix to process.
+ */
+void ApplyITRS (
+		TransformMatrixArray *matrices,
+		const double *x,
+		const double *y,
+		const double *rotation,
+		const double *scaleX,
+		const double *scaleY,
+		std::size_t begin,
+		std::size_t end);
+
+/**
+ * Multiplies a matrix by each matrix of a range, and stores the results in
+ * place of the latter: `matrices[i] = lhs * matrices[i]`.
+ *
+ * This is how a camera or a parent matrix is applied to many local matrices.
+ *
+ * @since 0.0.0
+ *
+ * @param lhs The matrix on the left of every multiplication.
+ * @param matrices The matrices on the right, overwritten by the results.
+ * @param begin The first matrix to process.
+ * @param end One past the last matrix to process.
+ */
+void Multiply (
+		const Components::TransformMatrix& lhs,
+		TransformMatrixArray *matrices,
+		std::size_t begin,
+		std::size_t end);
+
+/**
+ * Multiplies two ranges of matrices element by element, and stores the
+ * results in the first one: `matrices[i] = matrices[i] * rhs[i]`.
+ *
+ * @since 0.0.0
+ *
+ * @param matrices The matrices on the left, overwritten by the results.
+ * @param rhs The matrices on the right.
+ * @param begin The first matrix to process.
+ * @param end One past the last matrix to process.
+ */
+void Multiply (
+		TransformMatrixArray *matrices,
+		const TransformMatrixArray& rhs,
+		std::size_t begin,
+		std::size_t end);
+
+/**
+ * Decomposes a range of matrices into their translation, scale and rotation
+ * values.
+ *
+ * @since 0.0.0
+ *
+ * @param matrices The matrices to decompose.
+ * @param output The decomposed matrices. It must be at least `end` long.
+ * @param begin The first matrix to process.
+ * @param end One past the last matrix to process.
+ */
+void DecomposeMatrix (
+		const TransformMatrixArray& matrices,
+		DecomposedMatrix *output,
+		std::size_t begin,
+		std::size_t end);
+
+/**
+ * Transforms the four corners of a range of quads to window space.
+ *
+ * The corners of the quad `i` are `(0, 0)`, `(w, 0)`, `(w, h)` and `(0, h)`,
+ * where `w` and `h` come from `sizes[i]`. They are transformed by
+ * `matrices[i]`, then scaled by `scale` and moved by `offset`.
+ *
+ * @since 0.0.0
+ *
+ * @param matrices The matrix of each quad.
+ * @param sizes The size of each quad.
+ * @param scale The scale applied after the matrix.
+ * @param offset The offset applied after the scale.
+ * @param quads The transformed corners, four per quad, in the order:
+ * top-left, top-right, bottom-right, bottom-left.
+ * @param begin The first quad to process.
+ * @param end One past the last quad to process.
+ */
+void TransformQuads (
+		const TransformMatrixArray& matrices,
+		const SDL_FPoint *sizes,
+		SDL_FPoint scale,
+		SDL_FPoint offset,
+		SDL_FPoint *quads,
+		std::size_t begin,
+		std::size_t end);
+
+}	// namespace Zen
+
+#endif
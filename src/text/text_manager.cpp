@@ -7,9 +7,12 @@
 
 #include "text_manager.hpp"
 #include "../window/window.hpp"
+#include "../renderer/renderer.hpp"
 #include "../utils/map/contains.hpp"
 #include "../components/text.hpp"
 #include "../components/position.hpp"
+#include "../systems/alpha.hpp"
+#include "../systems/tint.hpp"
 #include <algorithm>
 #include <set>
 #include "../display/types/color.hpp"
@@ -24,6 +27,7 @@ namespace Zen {
 
 extern entt::registry g_registry;
 extern Window g_window;
+extern Renderer g_renderer;
 
 TextManager::~TextManager ()
 {
@@ -263,9 +267,11 @@ void TextManager::addGlyphs (std::vector<int> characters, TextStyle style)
 
 	// Regenerate the texture and reupload it to the GPU
 	if (atlas.texture)
-		SDL_DestroyTexture(atlas.texture);
+		g_renderer.destroyTexture(atlas.texture);
 
-	atlas.texture = SDL_CreateTextureFromSurface(g_window.renderer, atlas.surface);
+	g_renderer.invoke([&atlas] () {
+		atlas.texture = SDL_CreateTextureFromSurface(g_window.renderer, atlas.surface);
+	});
 
 	if (!atlas.texture)
 		MessageError("Unable to create a texture from the rendered font atlas! SDL Error: ", SDL_GetError());
@@ -284,7 +290,15 @@ void TextManager::render (Entity textEntity)
 		[text->style.color]
 		[text->style.decoration]
 		[text->style.outline];
-	SDL_SetTextureBlendMode(atlas.texture, SDL_BLENDMODE_BLEND);
+	g_renderer.setTextureBlendMode(atlas.texture, SDL_BLENDMODE_BLEND);
+
+	// The atlas is shared by the texts of this style, its modulation only
+	// changes between texts of a different tint or alpha
+	Color tint = GetTint(textEntity);
+	double alpha = std::clamp(GetAlpha(textEntity), 0., 1.);
+
+	g_renderer.setTextureColorMod(atlas.texture, tint.red, tint.green, tint.blue);
+	g_renderer.setTextureAlphaMod(atlas.texture, static_cast<Uint8>(alpha * 255));
 
 	// Convert all characters to unicodes
 	std::vector<int> characters = StringToUnicodes(text->text);
@@ -364,14 +378,10 @@ void TextManager::render (Entity textEntity)
 		// Drawn to this rectangle on the screen
 		SDL_Rect glyphDst {x, y, glyph.cacheW, glyph.cacheH};
 
-		SDL_RenderCopyEx(
-				g_window.renderer,
+		g_renderer.commandBuffer.copy(
 				atlas.texture,
 				&glyphSrc,
-				&glyphDst,
-				0,
-				nullptr,
-				SDL_FLIP_NONE
+				&glyphDst
 				);
 
 		penX += glyph.advanceX;
@@ -0,0 +1,73 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_TEXTURES_COMPONENTS_ALPHAMASK_HPP
+#define ZEN_TEXTURES_COMPONENTS_ALPHAMASK_HPP
+
+#include <SDL2/SDL_stdinc.h>
+#include <vector>
+
+namespace Zen {
+namespace Components {
+
+/**
+ * The alpha channel of a Texture Source, kept in memory for pixel-perfect
+ * hit tests.
+ *
+ * @since 0.0.0
+ */
+struct AlphaMask
+{
+	/**
+	 * The dimensions of the mask, those of the image of the Source.
+	 *
+	 * @property
+	 * @since 0.0.0
+	 */
+	int width = 0, height = 0;
+
+	/**
+	 * The bits per pixel: `8` for the alpha values, or `1` for whether each
+	 * pixel reached the threshold the mask was made with.
+	 *
+	 * @property
+	 * @since 0.0.0
+	 */
+	int depth = 8;
+
+	/**
+	 * The length of a row, in bytes.
+	 *
+	 * @property
+	 * @since 0.0.0
+	 */
+	int pitch = 0;
+
+	/**
+	 * The rows of the mask. In a 1-bit mask, the pixel `x` of a row is the
+	 * bit `x % 8` of its byte `x / 8`.
+	 *
+	 * @property
+	 * @since 0.0.0
+	 */
+	std::vector<Uint8> data;
+};
+
+/**
+ * The fully opaque pixels of a Texture Source, as a 1-bit mask. It is made
+ * from the decoded image, and kept until the opacity of the frames of the
+ * source is known.
+ *
+ * @since 0.0.0
+ */
+struct OpacityMask : AlphaMask
+{};
+
+} // namespace Components
+} // namespace Zen
+
+#endif
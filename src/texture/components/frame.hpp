@@ -148,6 +148,14 @@ struct Frame
 	 */
 	bool rotated = false;
 
+	/**
+	 * Are all the pixels of this frame fully opaque? Only computed when
+	 * `GameConfig::overdrawCulling` is set.
+	 *
+	 * @since 0.0.0
+	 */
+	bool opaque = false;
+
 	/**
 	 * OpenGL UV u0 value.
 	 *
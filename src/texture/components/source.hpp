@@ -9,6 +9,7 @@
 #define ZEN_TEXTURES_COMPONENTS_SOURCE_HPP
 
 #include <SDL2/SDL_render.h>
+#include <cstddef>
 #include <string>
 #include "../../ecs/entity.hpp"
 
@@ -66,6 +67,40 @@ struct TextureSource
 	 * @since 0.0.0
 	 */
 	int width, height;
+
+	/**
+	 * The size of the SDL_Texture in memory, in bytes.
+	 *
+	 * @property
+	 * @since 0.0.0
+	 */
+	std::size_t bytes = 0;
+
+	/**
+	 * Whether the SDL_Texture can be loaded again from `source`. Only such
+	 * Sources are released when over the texture budget.
+	 *
+	 * @property
+	 * @since 0.0.0
+	 */
+	bool reloadable = false;
+
+	/**
+	 * Whether the SDL_Texture was released to stay within the texture
+	 * budget. It is loaded again the next time it is used.
+	 *
+	 * @property
+	 * @since 0.0.0
+	 */
+	bool evicted = false;
+
+	/**
+	 * The frame of the renderer this Source was last drawn in.
+	 *
+	 * @property
+	 * @since 0.0.0
+	 */
+	Uint64 lastUsed = 0;
 };
 
 } // namespace Components
@@ -10,6 +10,8 @@
 
 #include "../../ecs/entity.hpp"
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace Zen {
 namespace Components {
@@ -37,6 +39,21 @@ struct Texture
 	int frameTotal;
 
 	Entity firstFrame;
+
+	/**
+	 * The Frames of this Texture, by name.
+	 *
+	 * @since 0.0.0
+	 */
+	std::unordered_map<std::string, Entity> frames;
+
+	/**
+	 * The Frames named after a number, such as the Frames of a Sprite Sheet,
+	 * at that number. `entt::null` where no Frame has that name.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entity> indexedFrames;
 };
 
 }	// namespace Components
@@ -0,0 +1,518 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "atlas_binary.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../../utils/messages.hpp"
+#include "../systems/texture.hpp"
+#include "../systems/frame.hpp"
+#include "../components/source.hpp"
+#include "../components/frame.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+static const char FILE_MAGIC[4] = {'Z', 'A', 'T', 'L'};
+
+static const Uint32 FILE_VERSION = 1;
+
+/**
+ * Gets the size and the write time of a file.
+ *
+ * @return `false` if the file doesn't exist.
+ */
+static bool FileStamp (const std::string& path, Uint64& size, Sint64& time)
+{
+	std::error_code error;
+
+	auto fileSize = std::filesystem::file_size(path, error);
+
+	if (error)
+		return false;
+
+	auto fileTime = std::filesystem::last_write_time(path, error);
+
+	if (error)
+		return false;
+
+	size = fileSize;
+	time = fileTime.time_since_epoch().count();
+
+	return true;
+}
+
+AtlasBinary::~AtlasBinary ()
+{
+	close();
+}
+
+bool AtlasBinary::open (std::string path_)
+{
+	close();
+
+	int file_ = ::open(path_.c_str(), O_RDONLY);
+
+	if (file_ < 0)
+		return false;
+
+	struct stat stat_;
+
+	if (fstat(file_, &stat_) != 0 ||
+		static_cast<std::size_t>(stat_.st_size) < sizeof(AtlasBinaryHeader))
+	{
+		::close(file_);
+		return false;
+	}
+
+	size = stat_.st_size;
+	data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_, 0);
+
+	// The mapping stays valid once the file is closed
+	::close(file_);
+
+	if (data == MAP_FAILED)
+	{
+		data = nullptr;
+		size = 0;
+
+		return false;
+	}
+
+	auto fail_ = [&] () {
+		MessageWarning("Invalid binary atlas, it will be made again: ", path_);
+		close();
+
+		return false;
+	};
+
+	header = static_cast<const AtlasBinaryHeader*>(data);
+
+	if (std::memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+		header->version != FILE_VERSION)
+		return fail_();
+
+	Uint64 expected_ = sizeof(AtlasBinaryHeader) +
+		static_cast<Uint64>(header->sourceCount) * sizeof(AtlasBinarySource) +
+		static_cast<Uint64>(header->frameCount) * sizeof(AtlasBinaryFrame) +
+		header->stringsSize;
+
+	if (expected_ != size)
+		return fail_();
+
+	const char *bytes_ = static_cast<const char*>(data);
+
+	sources = reinterpret_cast<const AtlasBinarySource*>(bytes_ + sizeof(AtlasBinaryHeader));
+	frames = reinterpret_cast<const AtlasBinaryFrame*>(sources + header->sourceCount);
+	strings = reinterpret_cast<const char*>(frames + header->frameCount);
+
+	// Every name must lie within the names
+	for (std::size_t i_ = 0; i_ < header->sourceCount; i_++)
+	{
+		if (static_cast<Uint64>(sources[i_].image) + sources[i_].imageLength > header->stringsSize)
+			return fail_();
+	}
+
+	for (std::size_t i_ = 0; i_ < header->frameCount; i_++)
+	{
+		if (static_cast<Uint64>(frames[i_].name) + frames[i_].nameLength > header->stringsSize)
+			return fail_();
+	}
+
+	return true;
+}
+
+void AtlasBinary::close ()
+{
+	if (data)
+		munmap(data, size);
+
+	data = nullptr;
+	size = 0;
+	header = nullptr;
+	sources = nullptr;
+	frames = nullptr;
+	strings = nullptr;
+}
+
+bool AtlasBinary::isFresh (std::string dataPath_) const
+{
+	if (!header)
+		return false;
+
+	Uint64 size_ = 0;
+	Sint64 time_ = 0;
+
+	// Without its JSON file, the binary atlas is all there is
+	if (!FileStamp(dataPath_, size_, time_))
+		return true;
+
+	return header->dataSize == size_ && header->dataTime == time_;
+}
+
+std::size_t AtlasBinary::sourceCount () const
+{
+	return header ? header->sourceCount : 0;
+}
+
+const AtlasBinarySource& AtlasBinary::source (std::size_t index_) const
+{
+	return sources[index_];
+}
+
+std::size_t AtlasBinary::frameCount () const
+{
+	return header ? header->frameCount : 0;
+}
+
+const AtlasBinaryFrame& AtlasBinary::frame (std::size_t index_) const
+{
+	return frames[index_];
+}
+
+std::string_view AtlasBinary::string (Uint32 offset_, Uint32 length_) const
+{
+	return std::string_view(strings + offset_, length_);
+}
+
+/**
+ * The tables of a binary atlas, as they are built.
+ */
+struct AtlasBinaryBuilder
+{
+	std::vector<AtlasBinarySource> sources;
+
+	std::vector<AtlasBinaryFrame> frames;
+
+	std::string strings;
+
+	std::unordered_map<std::string, Uint32> offsets;
+
+	/**
+	 * @return The offset of the name, stored once however many times it is
+	 * used.
+	 */
+	Uint32 intern (const std::string& name_)
+	{
+		auto it_ = offsets.find(name_);
+
+		if (it_ != offsets.end())
+			return it_->second;
+
+		Uint32 offset_ = strings.size();
+
+		strings += name_;
+		offsets.emplace(name_, offset_);
+
+		return offset_;
+	}
+};
+
+/**
+ * @return Whether the given key of a JSON frame is set to `true`.
+ */
+static bool JsonFlag (const nlohmann::json& src, const char *key)
+{
+	auto it = src.find(key);
+
+	return it != src.end() && it->is_boolean() && it->get<bool>();
+}
+
+/**
+ * Converts a frame of a JSON Array or JSON Hash atlas.
+ */
+static void AddJsonFrame (AtlasBinaryBuilder& builder, const std::string& name, int sourceIndex, const nlohmann::json& src)
+{
+	AtlasBinaryFrame frame {};
+
+	frame.name = builder.intern(name);
+	frame.nameLength = name.size();
+	frame.sourceIndex = sourceIndex;
+
+	const auto& cut = src.at("frame");
+	frame.x = cut.at("x").get<Sint32>();
+	frame.y = cut.at("y").get<Sint32>();
+	frame.width = cut.at("w").get<Sint32>();
+	frame.height = cut.at("h").get<Sint32>();
+
+	// These are the original (non-trimmed) sprite values
+	if (JsonFlag(src, "trimmed"))
+	{
+		frame.flags |= ATLAS_FRAME_TRIMMED;
+
+		frame.sourceWidth = src.at("sourceSize").at("w").get<Sint32>();
+		frame.sourceHeight = src.at("sourceSize").at("h").get<Sint32>();
+
+		const auto& trim = src.at("spriteSourceSize");
+		frame.trimX = trim.at("x").get<Sint32>();
+		frame.trimY = trim.at("y").get<Sint32>();
+		frame.trimWidth = trim.at("w").get<Sint32>();
+		frame.trimHeight = trim.at("h").get<Sint32>();
+	}
+
+	if (JsonFlag(src, "rotated"))
+		frame.flags |= ATLAS_FRAME_ROTATED;
+
+	auto pivot = src.find("anchor");
+
+	if (pivot == src.end() || pivot->is_null())
+		pivot = src.find("pivot");
+
+	if (pivot != src.end() && !pivot->is_null())
+	{
+		frame.flags |= ATLAS_FRAME_PIVOT;
+		frame.pivotX = pivot->at("x").get<float>();
+		frame.pivotY = pivot->at("y").get<float>();
+	}
+
+	builder.frames.emplace_back(frame);
+}
+
+/**
+ * Converts the frames of a single source, stored as a JSON Array or a JSON
+ * Hash.
+ */
+static void AddJsonFrames (AtlasBinaryBuilder& builder, int sourceIndex, const nlohmann::json& frames)
+{
+	if (frames.is_array())
+	{
+		for (const auto& src : frames)
+			AddJsonFrame(builder, src.at("filename").get<std::string>(), sourceIndex, src);
+	}
+	else
+	{
+		for (const auto& [key, src] : frames.items())
+			AddJsonFrame(builder, key, sourceIndex, src);
+	}
+}
+
+bool WriteAtlasBinary (std::string dataPath, const nlohmann::json& data, std::string path)
+{
+	AtlasBinaryHeader header {};
+	std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+	header.version = FILE_VERSION;
+
+	if (!FileStamp(dataPath, header.dataSize, header.dataTime))
+	{
+		MessageError("JSON file couldn't be opened: ", dataPath);
+		return false;
+	}
+
+	AtlasBinaryBuilder builder;
+
+	try
+	{
+		auto textures = data.find("textures");
+		auto frames = data.find("frames");
+
+		if (textures != data.end() && textures->is_array())
+		{
+			// Multi-Atlas, one source per texture
+			for (std::size_t i = 0; i < textures->size(); i++)
+			{
+				const auto& texture = (*textures)[i];
+				std::string image = texture.value("image", "");
+
+				builder.sources.push_back({builder.intern(image), static_cast<Uint32>(image.size())});
+
+				AddJsonFrames(builder, i, texture.at("frames"));
+			}
+		}
+		else if (frames != data.end() && (frames->is_array() || frames->is_object()))
+		{
+			builder.sources.push_back({0, 0});
+
+			AddJsonFrames(builder, 0, *frames);
+		}
+		else
+		{
+			MessageError("Invalid Texture Atlas JSON: ", dataPath);
+			return false;
+		}
+	}
+	catch (const nlohmann::json::exception& error)
+	{
+		MessageError("Invalid Texture Atlas JSON ", dataPath, ": ", error.what());
+		return false;
+	}
+
+	header.sourceCount = builder.sources.size();
+	header.frameCount = builder.frames.size();
+	header.stringsSize = builder.strings.size();
+
+	// Written aside then renamed, so that a partial file is never mapped
+	std::string temporaryPath = path + ".tmp";
+	std::FILE *file = std::fopen(temporaryPath.c_str(), "wb");
+
+	if (!file)
+	{
+		MessageWarning("Unable to write the binary atlas: ", path);
+		return false;
+	}
+
+	bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+
+	if (ok && !builder.sources.empty())
+		ok = std::fwrite(builder.sources.data(), sizeof(AtlasBinarySource), builder.sources.size(), file) == builder.sources.size();
+
+	if (ok && !builder.frames.empty())
+		ok = std::fwrite(builder.frames.data(), sizeof(AtlasBinaryFrame), builder.frames.size(), file) == builder.frames.size();
+
+	if (ok && !builder.strings.empty())
+		ok = std::fwrite(builder.strings.data(), 1, builder.strings.size(), file) == builder.strings.size();
+
+	ok = (std::fclose(file) == 0) && ok;
+
+	std::error_code error;
+
+	if (ok)
+		std::filesystem::rename(temporaryPath, path, error);
+
+	if (!ok || error)
+	{
+		std::filesystem::remove(temporaryPath, error);
+		MessageWarning("Unable to write the binary atlas: ", path);
+
+		return false;
+	}
+
+	return true;
+}
+
+bool OpenAtlasBinary (std::string dataPath, AtlasBinary& binary)
+{
+	std::string path = dataPath + ".bin";
+
+	if (binary.open(path) && binary.isFresh(dataPath))
+		return true;
+
+	binary.close();
+
+	// Missing or stale, make it from the JSON file
+	std::ifstream file (dataPath);
+
+	if (!file)
+	{
+		MessageError("JSON file couldn't be opened: ", dataPath);
+		return false;
+	}
+
+	nlohmann::json data;
+
+	try
+	{
+		file >> data;
+	}
+	catch (const nlohmann::json::exception& error)
+	{
+		MessageError("Invalid Texture Atlas JSON ", dataPath, ": ", error.what());
+		return false;
+	}
+
+	file.close();
+
+	if (!WriteAtlasBinary(dataPath, data, path))
+		return false;
+
+	return binary.open(path);
+}
+
+int ParseAtlasBinary (Entity texture, const AtlasBinary& binary)
+{
+	// The sources are looked up once, not for every frame
+	std::vector<Entity> sources (binary.sourceCount(), static_cast<Entity>(entt::null));
+
+	for (auto entity : g_registry.view<Components::TextureSource>())
+	{
+		auto& src = g_registry.get<Components::TextureSource>(entity);
+
+		if (src.texture == texture && src.index >= 0 &&
+			static_cast<std::size_t>(src.index) < sources.size())
+			sources[src.index] = entity;
+	}
+
+	ReserveFrames(texture, binary.frameCount() + binary.sourceCount());
+
+	// Add in a __BASE entry (for the entire atlas)
+	for (std::size_t i = 0; i < sources.size(); i++)
+	{
+		if (sources[i] == entt::null)
+		{
+			MessageError("The requested texture source does not exist.");
+			return -1;
+		}
+
+		auto& src = g_registry.get<Components::TextureSource>(sources[i]);
+
+		AddFrame(texture, sources[i], "__BASE", 0, 0, src.width, src.height);
+	}
+
+	for (std::size_t i = 0; i < binary.frameCount(); i++)
+	{
+		const auto& src = binary.frame(i);
+
+		if (src.sourceIndex < 0 || static_cast<std::size_t>(src.sourceIndex) >= sources.size())
+			continue;
+
+		Entity newFrame = AddFrame(
+				texture,
+				sources[src.sourceIndex],
+				std::string(binary.string(src.name, src.nameLength)),
+				src.x,
+				src.y,
+				src.width,
+				src.height
+				);
+
+		// A name used twice
+		if (newFrame == entt::null)
+			continue;
+
+		if (src.flags & ATLAS_FRAME_TRIMMED)
+		{
+			SetFrameTrim(
+					newFrame,
+					src.sourceWidth,
+					src.sourceHeight,
+					src.trimX,
+					src.trimY,
+					src.trimWidth,
+					src.trimHeight
+					);
+		}
+
+		auto& frame = g_registry.get<Components::Frame>(newFrame);
+
+		if (src.flags & ATLAS_FRAME_ROTATED)
+		{
+			frame.rotated = true;
+			UpdateFrameUVsInverted(newFrame);
+		}
+
+		if (src.flags & ATLAS_FRAME_PIVOT)
+		{
+			frame.customPivot = true;
+			frame.pivotX = src.pivotX;
+			frame.pivotY = src.pivotY;
+		}
+	}
+
+	return 0;
+}
+
+}	// namespace Zen
@@ -0,0 +1,229 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_TEXTURES_PARSERS_ATLASBINARY_HPP
+#define ZEN_TEXTURES_PARSERS_ATLASBINARY_HPP
+
+#include <SDL2/SDL_stdinc.h>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "json/json.hpp"
+#include "../../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * The start of a binary atlas file.
+ *
+ * It is followed by `sourceCount` AtlasBinarySource, `frameCount`
+ * AtlasBinaryFrame and `stringsSize` bytes of names, none of them null
+ * terminated.
+ *
+ * @since 0.0.0
+ */
+struct AtlasBinaryHeader
+{
+	char magic[4];
+
+	Uint32 version;
+
+	/**
+	 * The size and write time of the JSON file this was made from, to tell
+	 * when it changed.
+	 *
+	 * @since 0.0.0
+	 */
+	Uint64 dataSize;
+	Sint64 dataTime;
+
+	Uint32 sourceCount;
+	Uint32 frameCount;
+	Uint32 stringsSize;
+	Uint32 padding;
+};
+
+/**
+ * A source image of a binary atlas.
+ *
+ * @since 0.0.0
+ */
+struct AtlasBinarySource
+{
+	/**
+	 * The file name of the image, as an offset and length in the names. Empty
+	 * if the atlas doesn't name it.
+	 *
+	 * @since 0.0.0
+	 */
+	Uint32 image, imageLength;
+};
+
+/**
+ * A frame of a binary atlas.
+ *
+ * @since 0.0.0
+ */
+struct AtlasBinaryFrame
+{
+	/**
+	 * The name of the frame, as an offset and length in the names.
+	 *
+	 * @since 0.0.0
+	 */
+	Uint32 name, nameLength;
+
+	Sint32 sourceIndex;
+
+	/**
+	 * The area to cut the frame out of its source.
+	 *
+	 * @since 0.0.0
+	 */
+	Sint32 x, y, width, height;
+
+	/**
+	 * The untrimmed size of the frame, and the area it is drawn at within it.
+	 *
+	 * @since 0.0.0
+	 */
+	Sint32 sourceWidth, sourceHeight;
+	Sint32 trimX, trimY, trimWidth, trimHeight;
+
+	/**
+	 * A combination of `ATLAS_FRAME_TRIMMED`, `ATLAS_FRAME_ROTATED` and
+	 * `ATLAS_FRAME_PIVOT`.
+	 *
+	 * @since 0.0.0
+	 */
+	Uint32 flags;
+
+	float pivotX, pivotY;
+};
+
+const Uint32 ATLAS_FRAME_TRIMMED = 1;
+const Uint32 ATLAS_FRAME_ROTATED = 2;
+const Uint32 ATLAS_FRAME_PIVOT = 4;
+
+/**
+ * A binary atlas file mapped in memory.
+ *
+ * Its frames are read in place, there is nothing to parse.
+ *
+ * @class AtlasBinary
+ * @since 0.0.0
+ */
+class AtlasBinary
+{
+public:
+	AtlasBinary () = default;
+
+	AtlasBinary (const AtlasBinary&) = delete;
+
+	AtlasBinary& operator = (const AtlasBinary&) = delete;
+
+	~AtlasBinary ();
+
+	/**
+	 * Maps a binary atlas file, and checks that it is whole.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param path_ The path to the binary atlas file.
+	 *
+	 * @return `true` if the file is a valid binary atlas.
+	 */
+	bool open (std::string path_);
+
+	/**
+	 * Unmaps the file.
+	 *
+	 * @since 0.0.0
+	 */
+	void close ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param dataPath_ The path to the JSON file of the atlas.
+	 *
+	 * @return `true` if the JSON file is unchanged since this was made.
+	 */
+	bool isFresh (std::string dataPath_) const;
+
+	std::size_t sourceCount () const;
+
+	const AtlasBinarySource& source (std::size_t index_) const;
+
+	std::size_t frameCount () const;
+
+	const AtlasBinaryFrame& frame (std::size_t index_) const;
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The name at the given offset and length in the names.
+	 */
+	std::string_view string (Uint32 offset_, Uint32 length_) const;
+
+private:
+	void *data = nullptr;
+
+	std::size_t size = 0;
+
+	const AtlasBinaryHeader *header = nullptr;
+
+	const AtlasBinarySource *sources = nullptr;
+
+	const AtlasBinaryFrame *frames = nullptr;
+
+	const char *strings = nullptr;
+};
+
+/**
+ * Converts the data of a JSON Array or JSON Hash atlas to a binary atlas
+ * file.
+ *
+ * @since 0.0.0
+ *
+ * @param dataPath The path to the JSON file the data was read from.
+ * @param data The parsed JSON data.
+ * @param path The path of the binary atlas file to write.
+ *
+ * @return `true` if the file was written.
+ */
+bool WriteAtlasBinary (std::string dataPath, const nlohmann::json& data, std::string path);
+
+/**
+ * Maps the binary copy of a JSON atlas, saved next to it with the `.bin`
+ * extension. The copy is made, or made again, if it is missing or older
+ * than the JSON file.
+ *
+ * @since 0.0.0
+ *
+ * @param dataPath The path to the JSON file of the atlas.
+ * @param binary The AtlasBinary to map the copy with.
+ *
+ * @return `true` if the copy is mapped.
+ */
+bool OpenAtlasBinary (std::string dataPath, AtlasBinary& binary);
+
+/**
+ * Adds the frames of a binary atlas to a Texture.
+ *
+ * @since 0.0.0
+ *
+ * @param texture The Texture to add the frames to.
+ * @param binary The mapped binary atlas.
+ *
+ * @return `0` on success, `-1` if a source of the atlas is missing.
+ */
+int ParseAtlasBinary (Entity texture, const AtlasBinary& binary);
+
+}	// namespace Zen
+
+#endif
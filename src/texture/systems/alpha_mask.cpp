@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "alpha_mask.hpp"
+
+#include <algorithm>
+#include "../../utils/messages.hpp"
+
+namespace Zen {
+
+Components::AlphaMask CreateAlphaMask (SDL_Surface *surface, int depth, Uint8 threshold)
+{
+	Components::AlphaMask mask;
+
+	if (!surface)
+		return mask;
+
+	// A single format to read the alpha channel from
+	SDL_Surface *converted = surface;
+
+	if (surface->format->format != SDL_PIXELFORMAT_ARGB8888)
+		converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+
+	if (!converted)
+	{
+		MessageError("Unable to convert the image of an alpha mask: ", SDL_GetError());
+
+		return mask;
+	}
+
+	mask.width = converted->w;
+	mask.height = converted->h;
+	mask.depth = (depth == 1) ? 1 : 8;
+	mask.pitch = (mask.depth == 1) ? (mask.width + 7) / 8 : mask.width;
+	mask.data.assign(static_cast<std::size_t>(mask.pitch) * mask.height, 0);
+
+	for (int y = 0; y < mask.height; y++)
+	{
+		const Uint32 *pixels = reinterpret_cast<const Uint32*>(
+				static_cast<const Uint8*>(converted->pixels) + y * converted->pitch);
+
+		Uint8 *row = &mask.data[static_cast<std::size_t>(y) * mask.pitch];
+
+		if (mask.depth == 8)
+		{
+			for (int x = 0; x < mask.width; x++)
+				row[x] = static_cast<Uint8>(pixels[x] >> 24);
+
+			continue;
+		}
+
+		for (int x = 0; x < mask.width; x++)
+		{
+			if ((pixels[x] >> 24) >= threshold)
+				row[x >> 3] |= static_cast<Uint8>(1 << (x & 7));
+		}
+	}
+
+	if (converted != surface)
+		SDL_FreeSurface(converted);
+
+	return mask;
+}
+
+int GetAlphaMaskValue (const Components::AlphaMask& mask, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= mask.width || y >= mask.height)
+		return -1;
+
+	const Uint8 *row = &mask.data[static_cast<std::size_t>(y) * mask.pitch];
+
+	if (mask.depth == 8)
+		return row[x];
+
+	return (row[x >> 3] & (1 << (x & 7))) ? 255 : 0;
+}
+
+bool IsAlphaMaskFull (const Components::AlphaMask& mask, int x, int y, int width, int height)
+{
+	int left = std::max(0, x);
+	int top = std::max(0, y);
+	int right = std::min(mask.width, x + width);
+	int bottom = std::min(mask.height, y + height);
+
+	if (right <= left || bottom <= top)
+		return false;
+
+	for (int j = top; j < bottom; j++)
+	{
+		const Uint8 *row = &mask.data[static_cast<std::size_t>(j) * mask.pitch];
+
+		if (mask.depth == 8)
+		{
+			for (int i = left; i < right; i++)
+				if (row[i] != 0xff)
+					return false;
+
+			continue;
+		}
+
+		// Whole bytes at once, the bits at the edges one by one
+		int i = left;
+
+		for (; i < right && (i & 7); i++)
+			if (!(row[i >> 3] & (1 << (i & 7))))
+				return false;
+
+		for (; i + 8 <= right; i += 8)
+			if (row[i >> 3] != 0xff)
+				return false;
+
+		for (; i < right; i++)
+			if (!(row[i >> 3] & (1 << (i & 7))))
+				return false;
+	}
+
+	return true;
+}
+
+}	// namespace Zen
@@ -0,0 +1,60 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_TEXTURES_SYSTEMS_ALPHAMASK_HPP
+#define ZEN_TEXTURES_SYSTEMS_ALPHAMASK_HPP
+
+#include <SDL2/SDL_surface.h>
+#include "../components/alpha_mask.hpp"
+
+namespace Zen {
+
+/**
+ * Packs the alpha channel of an image.
+ *
+ * This doesn't touch the renderer, and can run on any thread.
+ *
+ * @since 0.0.0
+ *
+ * @param surface The decoded image.
+ * @param depth `1` for a mask of the pixels whose alpha reaches the
+ * threshold, `8` for the alpha values.
+ * @param threshold The lowest alpha of a set pixel in a 1-bit mask.
+ *
+ * @return The mask, empty if the image couldn't be converted.
+ */
+Components::AlphaMask CreateAlphaMask (SDL_Surface *surface, int depth, Uint8 threshold);
+
+/**
+ * @since 0.0.0
+ *
+ * @param mask The mask to read.
+ * @param x The x coordinate of the pixel.
+ * @param y The y coordinate of the pixel.
+ *
+ * @return The alpha value (0-255) of the pixel, `255` or `0` in a 1-bit mask,
+ * or `-1` if the coordinates are out of bounds.
+ */
+int GetAlphaMaskValue (const Components::AlphaMask& mask, int x, int y);
+
+/**
+ * @since 0.0.0
+ *
+ * @param mask The mask to read.
+ * @param x The x coordinate of the area.
+ * @param y The y coordinate of the area.
+ * @param width The width of the area.
+ * @param height The height of the area.
+ *
+ * @return `true` if every pixel of the area within the mask is set, or fully
+ * opaque in an 8-bit mask. `false` if no pixel of the area is in the mask.
+ */
+bool IsAlphaMaskFull (const Components::AlphaMask& mask, int x, int y, int width, int height);
+
+}	// namespace Zen
+
+#endif
@@ -38,6 +38,8 @@ Entity CreateFrame (Entity source, std::string name, int x, int y, int width, in
 
 	SetFrameSize(frame, width, height, x, y);
 
+	UpdateFrameUVs(frame);
+
 	return frame;
 }
 
@@ -9,46 +9,128 @@
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <unordered_map>
 #include "../../utils/assert.hpp"
 #include "../../utils/base64/base64_decode.hpp"
 #include "../../utils/messages.hpp"
 #include "../components/source.hpp"
+#include "../../core/config.hpp"
+#include "alpha_mask.hpp"
 #include "../../window/window.hpp"
+#include "../../renderer/renderer.hpp"
 
 namespace Zen {
 
 extern entt::registry g_registry;
 extern Window g_window;
+extern Renderer g_renderer;
+extern GameConfig *g_config;
 
-Entity CreateTextureSource (Entity texture, std::string src, int index)
+/**
+ * An image decoded ahead of time.
+ */
+struct StagedSource
+{
+	SDL_Surface *surface = nullptr;
+
+	Components::AlphaMask opacity;
+};
+
+/**
+ * The images decoded ahead of time, by source.
+ */
+static std::unordered_map<std::string, StagedSource> StagedSources;
+
+/**
+ * Loads the SDL texture of a source, on the thread owning the SDL renderer.
+ *
+ * @param src A path to an image file, or Base64 image data.
+ * @param staged The image decoded ahead of time, if any.
+ */
+static SDL_Texture* LoadSourceTexture (const std::string& src, SDL_Surface *staged)
 {
 	SDL_Texture *sdlTexture = nullptr;
-	int width, height;
 
-	// We first load the texture
-	if (src.size() > 10 && src.substr(0, 10) == "iVBORw0KGg")
-	{
-		// Source is a Base64 Image data
-		std::string base64 = Base64Decode(src);
+	g_renderer.invoke([&] () {
+		if (staged)
+		{
+			// Already decoded, only upload it
+			sdlTexture = SDL_CreateTextureFromSurface(g_window.renderer, staged);
+		}
+		else if (src.size() > 10 && src.substr(0, 10) == "iVBORw0KGg")
+		{
+			// Source is a Base64 Image data
+			std::string base64 = Base64Decode(src);
 
-		SDL_RWops *rw_ = SDL_RWFromConstMem(base64.c_str(), base64.size());
+			SDL_RWops *rw_ = SDL_RWFromConstMem(base64.c_str(), base64.size());
 
-		sdlTexture = IMG_LoadTextureTyped_RW(
-				g_window.renderer,
-				rw_,
-				1,		// The SDL_RWops will be closed automatically
-				"PNG"
-				);
+			sdlTexture = IMG_LoadTextureTyped_RW(
+					g_window.renderer,
+					rw_,
+					1,		// The SDL_RWops will be closed automatically
+					"PNG"
+					);
+		}
+		else
+		{
+			// Source is an image file path
+			sdlTexture = IMG_LoadTexture(
+					g_window.renderer,
+					src.c_str()
+					);
+		}
+	});
+
+	return sdlTexture;
+}
+
+/**
+ * @return The size of an SDL texture in memory, in bytes.
+ */
+static std::size_t TextureBytes (SDL_Texture *sdlTexture)
+{
+	Uint32 format = SDL_PIXELFORMAT_UNKNOWN;
+	int width = 0, height = 0;
+
+	SDL_QueryTexture(sdlTexture, &format, nullptr, &width, &height);
+
+	int bytesPerPixel = SDL_BYTESPERPIXEL(format);
+
+	return static_cast<std::size_t>(width) * height * (bytesPerPixel ? bytesPerPixel : 4);
+}
+
+Entity CreateTextureSource (Entity texture, std::string src, int index)
+{
+	int width, height;
+
+	SDL_Surface *staged = nullptr;
+	Components::AlphaMask opacity;
+
+	auto it = StagedSources.find(src);
+	if (it != StagedSources.end())
+	{
+		staged = it->second.surface;
+		opacity = std::move(it->second.opacity);
+		StagedSources.erase(it);
 	}
-	else
+
+	// The opaque pixels are read from the image before it is uploaded, so
+	// that it is decoded only once
+	if (g_config && g_config->overdrawCulling && opacity.data.empty())
 	{
-		// Source is an image file path
-		sdlTexture = IMG_LoadTexture(
-				g_window.renderer,
-				src.c_str()
-				);
+		if (!staged)
+			staged = DecodeTextureSource(src);
+
+		opacity = CreateAlphaMask(staged, 1, 0xff);
 	}
 
+	// We first load the texture, on the thread owning the SDL renderer
+	SDL_Texture *sdlTexture = LoadSourceTexture(src, staged);
+
+	if (staged)
+		SDL_FreeSurface(staged);
+
 	// Check if the texture loaded correctly
 	if (!sdlTexture)
 	{
@@ -62,7 +144,7 @@ Entity CreateTextureSource (Entity texture, std::string src, int index)
 
 		// Create a Texture Source entity
 		auto source = g_registry.create();
-		g_registry.emplace<Components::TextureSource>(
+		auto& component = g_registry.emplace<Components::TextureSource>(
 				source,
 				texture,
 				src.c_str(),
@@ -73,19 +155,160 @@ Entity CreateTextureSource (Entity texture, std::string src, int index)
 				height
 				);
 
+		component.bytes = TextureBytes(sdlTexture);
+		component.reloadable = true;
+
+		if (!opacity.data.empty())
+		{
+			auto& mask = g_registry.emplace<Components::OpacityMask>(source);
+			static_cast<Components::AlphaMask&>(mask) = std::move(opacity);
+		}
+
 		return source;
 	}
 }
 
+Entity CreateTextureSource (Entity texture, SDL_Texture *sdlTexture, int index)
+{
+	if (!sdlTexture)
+		return entt::null;
+
+	int width, height;
+	SDL_QueryTexture(sdlTexture, nullptr, nullptr, &width, &height);
+
+	auto source = g_registry.create();
+
+	auto& component = g_registry.emplace<Components::TextureSource>(
+			source,
+			texture,
+			"__RENDER_TEXTURE",
+			index,
+			1.0,
+			sdlTexture,
+			width,
+			height
+			);
+
+	// Its contents are drawn, there is no file to load them again from
+	component.bytes = TextureBytes(sdlTexture);
+
+	return source;
+}
+
 void DestroyTextureSource (Entity source)
 {
 	auto src = g_registry.try_get<Components::TextureSource>(source);
 	ZEN_ASSERT(src, "The entity has no 'TextureSource' component.");
 
 	if (src->sdlTexture)
-		SDL_DestroyTexture(src->sdlTexture);
+		g_renderer.destroyTexture(src->sdlTexture);
 
 	g_registry.destroy(source);
 }
 
+bool EvictTextureSource (Entity source)
+{
+	auto src = g_registry.try_get<Components::TextureSource>(source);
+	ZEN_ASSERT(src, "The entity has no 'TextureSource' component.");
+
+	if (!src->reloadable || !src->sdlTexture)
+		return false;
+
+	// Destroyed once the commands drawing it have run
+	g_renderer.destroyTexture(src->sdlTexture);
+
+	src->sdlTexture = nullptr;
+	src->evicted = true;
+
+	return true;
+}
+
+bool RestoreTextureSource (Entity source)
+{
+	auto src = g_registry.try_get<Components::TextureSource>(source);
+	ZEN_ASSERT(src, "The entity has no 'TextureSource' component.");
+
+	// Kept until the next frame at least. Read between two frames, as by
+	// getPixel, it would otherwise be released again by the texture budget
+	// of the frame being rendered
+	src->lastUsed = std::max(src->lastUsed, g_renderer.frameCount + 1);
+
+	if (src->sdlTexture)
+		return true;
+
+	if (!src->evicted)
+		return false;
+
+	src->sdlTexture = LoadSourceTexture(src->source, nullptr);
+
+	if (!src->sdlTexture)
+	{
+		MessageError("Texture couldn't be reloaded: ", src->source, ": ", IMG_GetError());
+
+		// Don't try again every frame
+		src->evicted = false;
+		src->reloadable = false;
+
+		return false;
+	}
+
+	src->evicted = false;
+	src->bytes = TextureBytes(src->sdlTexture);
+
+	return true;
+}
+
+SDL_Texture* UseTextureSource (Entity source, Uint64 frame)
+{
+	auto src = g_registry.try_get<Components::TextureSource>(source);
+	ZEN_ASSERT(src, "The entity has no 'TextureSource' component.");
+
+	src->lastUsed = frame;
+
+	if (!src->sdlTexture)
+		RestoreTextureSource(source);
+
+	return src->sdlTexture;
+}
+
+SDL_Surface* DecodeTextureSource (std::string src)
+{
+	if (src.size() > 10 && src.substr(0, 10) == "iVBORw0KGg")
+	{
+		// Source is a Base64 Image data
+		std::string base64 = Base64Decode(src);
+
+		SDL_RWops *rw_ = SDL_RWFromConstMem(base64.c_str(), base64.size());
+
+		return IMG_LoadTyped_RW(rw_, 1, "PNG");
+	}
+
+	// Source is an image file path
+	return IMG_Load(src.c_str());
+}
+
+void StageTextureSource (std::string src, SDL_Surface *surface,
+		Components::AlphaMask opacity)
+{
+	if (!surface)
+		return;
+
+	auto& staged = StagedSources[src];
+
+	// The same source twice, keep the latest
+	if (staged.surface)
+		SDL_FreeSurface(staged.surface);
+
+	staged.surface = surface;
+	staged.opacity = std::move(opacity);
+}
+
+void ClearStagedTextureSources ()
+{
+	for (auto& [src, staged] : StagedSources)
+		SDL_FreeSurface(staged.surface);
+
+	StagedSources.clear();
+}
+
 }	// namespace Zen
@@ -9,14 +9,89 @@
 #define ZEN_TEXTURES_SYSTEMS_SOURCE_HPP
 
 #include <string>
+#include <SDL2/SDL_render.h>
 #include "../../ecs/entity.hpp"
+#include "../components/alpha_mask.hpp"
 
 namespace Zen {
 
 Entity CreateTextureSource (Entity texture, std::string src, int index);
 
+/**
+ * Creates a Texture Source from an existing SDL texture, such as the target
+ * of a Render Texture. The source takes ownership of it.
+ *
+ * @since 0.0.0
+ */
+Entity CreateTextureSource (Entity texture, SDL_Texture *sdlTexture, int index);
+
 void DestroyTextureSource (Entity source);
 
+/**
+ * Releases the SDL texture of a source loaded from a file, to save memory.
+ * It is loaded again by `RestoreTextureSource` or `UseTextureSource`.
+ *
+ * @since 0.0.0
+ *
+ * @return `true` if the texture was released.
+ */
+bool EvictTextureSource (Entity source);
+
+/**
+ * Loads the SDL texture of a source again, if it was released, and marks it
+ * as used in the current frame of the renderer.
+ *
+ * @since 0.0.0
+ *
+ * @return `true` if the source has its SDL texture.
+ */
+bool RestoreTextureSource (Entity source);
+
+/**
+ * Stamps a source as drawn in the given frame of the renderer, loading its
+ * SDL texture again if it was released.
+ *
+ * @since 0.0.0
+ *
+ * @param frame The frame of the renderer.
+ *
+ * @return The SDL texture of the source, `nullptr` if it couldn't be loaded.
+ */
+SDL_Texture* UseTextureSource (Entity source, Uint64 frame);
+
+/**
+ * Decodes the image of a source without touching the renderer, so it can run
+ * on any thread.
+ *
+ * @since 0.0.0
+ *
+ * @param src A path to an image file, or Base64 image data.
+ *
+ * @return The decoded image, or `nullptr` if it couldn't be loaded.
+ */
+SDL_Surface* DecodeTextureSource (std::string src);
+
+/**
+ * Hands an image decoded ahead of time to the next `CreateTextureSource` of
+ * the same source, which then only uploads it. Takes ownership of the
+ * surface.
+ *
+ * @since 0.0.0
+ *
+ * @param src The source the image was decoded from.
+ * @param surface The decoded image.
+ * @param opacity The fully opaque pixels of the image, if already known.
+ */
+void StageTextureSource (std::string src, SDL_Surface *surface,
+		Components::AlphaMask opacity = {});
+
+/**
+ * Frees the staged images no source was created from.
+ *
+ * @since 0.0.0
+ */
+void ClearStagedTextureSources ();
+
 }	// namespace Zen
 
 #endif
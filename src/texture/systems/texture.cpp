@@ -28,7 +28,10 @@ Entity CreateTexture (std::string key, std::vector<std::string> sources)
 
 	// Create the texture entity
 	auto texture = g_registry.create();
-	g_registry.emplace<Components::Texture>(texture, key, 0, entt::null);
+	auto& tx = g_registry.emplace<Components::Texture>(texture);
+	tx.key = key;
+	tx.frameTotal = 0;
+	tx.firstFrame = entt::null;
 	
 	// Load the Sources
 	for (size_t i = 0; i < sources.size(); i++)
@@ -51,17 +54,82 @@ Entity CreateTexture (std::string key, std::vector<std::string> sources)
 	return texture;
 }
 
+Entity CreateTexture (std::string key, SDL_Texture *sdlTexture)
+{
+	auto texture = g_registry.create();
+	auto& tx = g_registry.emplace<Components::Texture>(texture);
+	tx.key = key;
+	tx.frameTotal = 0;
+	tx.firstFrame = entt::null;
+
+	if (CreateTextureSource(texture, sdlTexture, 0) == entt::null)
+	{
+		g_registry.destroy(texture);
+
+		return entt::null;
+	}
+
+	return texture;
+}
+
 void DestroyTexture (Entity texture)
 {
+	auto tx = g_registry.try_get<Components::Texture>(texture);
+	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
+
+	for (auto& [name, frame] : tx->frames)
+		g_registry.destroy(frame);
+
+	// Released ones included
+	std::vector<Entity> sources;
+
+	for (auto entity : g_registry.view<Components::TextureSource>())
+	{
+		if (g_registry.get<Components::TextureSource>(entity).texture == texture)
+			sources.emplace_back(entity);
+	}
+
+	for (auto source : sources)
+		DestroyTextureSource(source);
+
 	g_registry.destroy(texture);
 }
 
+/**
+ * The number of Frames named after a number that are indexed, the others are
+ * only found by name.
+ */
+static const int MAX_INDEXED_FRAMES = 65536;
+
+/**
+ * @return The number a Frame name is written as, or `-1` if it isn't one, or
+ * is too large to be indexed.
+ */
+static int FrameIndex (const std::string& name)
+{
+	if (name.empty() || name.size() > 5 || (name.size() > 1 && name[0] == '0'))
+		return -1;
+
+	int index = 0;
+
+	for (char c : name)
+	{
+		if (c < '0' || c > '9')
+			return -1;
+
+		index = index * 10 + (c - '0');
+	}
+
+	return (index < MAX_INDEXED_FRAMES) ? index : -1;
+}
+
 Entity AddFrame (Entity texture, std::string name, int sourceIndex, int x, int y, int width, int height)
 {
-	if (HasFrame(texture, name))
-		return entt::null;
+	auto tx = g_registry.try_get<Components::Texture>(texture);
+	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
 
-	Entity frame;
+	if (tx->frames.count(name))
+		return entt::null;
 
 	// Get the source in the texture with the given index
 	for (auto entity : g_registry.view<Components::TextureSource>())
@@ -69,98 +137,99 @@ Entity AddFrame (Entity texture, std::string name, int sourceIndex, int x, int y
 		auto& source = g_registry.get<Components::TextureSource>(entity);
 
 		if (source.texture == texture && source.index == sourceIndex)
-		{
-			frame = CreateFrame(entity, name, x, y, width, height);
+			return AddFrame(texture, entity, std::move(name), x, y, width, height);
+	}
 
-			auto& tx = g_registry.get<Components::Texture>(texture);
+	return entt::null;
+}
 
-			tx.firstFrame = frame;
+Entity AddFrame (Entity texture, Entity source, std::string name, int x, int y, int width, int height)
+{
+	auto tx = g_registry.try_get<Components::Texture>(texture);
+	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
 
-			tx.frameTotal++;
+	if (tx->frames.count(name))
+		return entt::null;
 
-			return frame;
-		}
+	int index = FrameIndex(name);
+
+	Entity frame = CreateFrame(source, name, x, y, width, height);
+
+	// Creating the frame may have moved the component
+	tx = &g_registry.get<Components::Texture>(texture);
+
+	tx->frames.emplace(std::move(name), frame);
+
+	if (index >= 0)
+	{
+		if (static_cast<std::size_t>(index) >= tx->indexedFrames.size())
+			tx->indexedFrames.resize(index + 1, entt::null);
+
+		tx->indexedFrames[index] = frame;
 	}
 
-	return entt::null;
+	tx->firstFrame = frame;
+
+	tx->frameTotal++;
+
+	return frame;
 }
 
 Entity AddFrame (Entity texture, int index, int sourceIndex, int x, int y, int width, int height)
 {
-	return AddFrame(texture, std::to_string(index).c_str(), sourceIndex, x, y, width, height);
+	return AddFrame(texture, std::to_string(index), sourceIndex, x, y, width, height);
 }
 
-bool RemoveFrame (Entity texture, std::string name)
+void ReserveFrames (Entity texture, std::size_t count)
 {
-	auto frame = GetFrame(texture, name);
+	auto tx = g_registry.try_get<Components::Texture>(texture);
+	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
 
-	if (frame != entt::null)
-	{
-		g_registry.destroy(frame);
+	tx->frames.reserve(tx->frames.size() + count);
+}
+
+bool RemoveFrame (Entity texture, std::string name)
+{
+	auto tx = g_registry.try_get<Components::Texture>(texture);
+	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
 
-		auto& tx = g_registry.get<Components::Texture>(texture);
-		tx.frameTotal--;
+	auto it = tx->frames.find(name);
 
-		return true;
-	}
-	else
-	{
+	if (it == tx->frames.end())
 		return false;
-	}
 
-	/*
-	if (!HasFrame(texture, name))
-		return false;
+	Entity frame = it->second;
 
-	auto& tx = g_registry.get<Components::Texture>(texture);
+	tx->frames.erase(it);
 
-	for (auto entity : g_registry.view<Components::Frame>())
-	{
-		auto& frame = g_registry.get<Components::Frame>(entity);
+	int index = FrameIndex(name);
 
-		if (frame.texture == texture && name == frame.name)
-		{
-			g_registry.destroy(entity);
-			break;
-		}
-	}
+	if (index >= 0 && static_cast<std::size_t>(index) < tx->indexedFrames.size())
+		tx->indexedFrames[index] = entt::null;
 
-	tx.frameTotal--;
+	tx->frameTotal--;
+
+	g_registry.destroy(frame);
 
 	return true;
-	*/
 }
 
 bool RemoveFrame (Entity texture, int index)
 {
-	return RemoveFrame(texture, std::to_string(index).c_str());
+	return RemoveFrame(texture, std::to_string(index));
 }
 
 bool HasFrame (Entity texture, std::string name)
 {
-	return GetFrame(texture, name) != entt::null;
-
-	/*
 	auto tx = g_registry.try_get<Components::Texture>(texture);
 	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
 
-	for (auto entity : g_registry.view<Components::Frame>())
-	{
-		auto& frame = g_registry.get<Components::Frame>(entity);
-
-		if (frame.texture == texture && name == frame.name)
-		{
-			return true;
-		}
-	}
-
-	return false;
-	*/
+	return tx->frames.count(name) > 0;
 }
 
 bool HasFrame (Entity texture, int index)
 {
-	return HasFrame(texture, std::to_string(index));
+	return GetFrame(texture, index) != entt::null;
 }
 
 Entity GetFrame (Entity texture, std::string name)
@@ -168,31 +237,27 @@ Entity GetFrame (Entity texture, std::string name)
 	auto tx = g_registry.try_get<Components::Texture>(texture);
 	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
 
-	Entity frame = entt::null;
-
 	if (name.empty())
-	{
-		frame = tx->firstFrame;
-	}
-	else
-	{
-		for (auto entity : g_registry.view<Components::Frame>())
-		{
-			auto& fr = g_registry.get<Components::Frame>(entity);
-			auto& src = g_registry.get<Components::TextureSource>(fr.source);
-			if (src.texture == texture && name == fr.name)
-			{
-				frame = entity;
-				break;
-			}
-		}
-	}
+		return tx->firstFrame;
 
-	return frame;
+	auto it = tx->frames.find(name);
+
+	return (it != tx->frames.end()) ? it->second : entt::null;
 }
 
 Entity GetFrame (Entity texture, int index)
 {
+	auto tx = g_registry.try_get<Components::Texture>(texture);
+	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
+
+	if (index >= 0 && index < MAX_INDEXED_FRAMES)
+	{
+		if (static_cast<std::size_t>(index) < tx->indexedFrames.size())
+			return tx->indexedFrames[index];
+
+		return entt::null;
+	}
+
 	return GetFrame(texture, std::to_string(index));
 }
 
@@ -206,17 +271,20 @@ int GetTextureSourceIndex (Entity source)
 
 std::vector<Entity> GetFramesFromSource (Entity source, bool includeBase)
 {
+	auto src = g_registry.try_get<Components::TextureSource>(source);
+	ZEN_ASSERT(src, "The entity has no 'TextureSource' component.");
+
+	auto& tx = g_registry.get<Components::Texture>(src->texture);
+
 	std::vector<Entity> output;
 
-	for (auto entity : g_registry.view<Components::Frame>())
+	for (auto& [name, frame] : tx.frames)
 	{
-		auto& frame = g_registry.get<Components::Frame>(entity);
-
-		if (std::string("__BASE") == frame.name && !includeBase)
+		if (name == "__BASE" && !includeBase)
 			continue;
 
-		if (frame.source == source)
-			output.emplace_back(entity);
+		if (g_registry.get<Components::Frame>(frame).source == source)
+			output.emplace_back(frame);
 	}
 
 	return output;
@@ -224,21 +292,17 @@ std::vector<Entity> GetFramesFromSource (Entity source, bool includeBase)
 
 std::vector<std::string> GetFrameNames (Entity texture, bool includeBase)
 {
-	auto tx = g_registry.try_get<Components::TextureSource>(texture);
-	ZEN_ASSERT(tx, "The entity has no 'TextureSource' component.");
+	auto tx = g_registry.try_get<Components::Texture>(texture);
+	ZEN_ASSERT(tx, "The entity has no 'Texture' component.");
 
 	std::vector<std::string> output;
 
-	for (auto frame : g_registry.view<Components::Frame>())
+	for (auto& [name, frame] : tx->frames)
 	{
-		auto& fr = g_registry.get<Components::Frame>(frame);
-		auto& src = g_registry.get<Components::TextureSource>(fr.source);
-
-		if (std::string("__BASE") == fr.name && !includeBase)
+		if (name == "__BASE" && !includeBase)
 			continue;
 
-		if (src.texture == texture)
-			output.emplace_back(fr.name);
+		output.emplace_back(name);
 	}
 
 	return output;
@@ -257,7 +321,7 @@ std::vector<Entity> GetTextureSources (Entity texture)
 	{
 		auto& src_ = g_registry.get<Components::TextureSource>(source_);
 
-		if (src_.sdlTexture)
+		if (src_.texture == texture)
 		{
 			out_.push_back(source_);
 		}
@@ -279,7 +343,7 @@ std::vector<std::string> GetTextureSourceFiles (Entity texture)
 	{
 		auto& src_ = g_registry.get<Components::TextureSource>(source_);
 
-		if (src_.sdlTexture)
+		if (src_.texture == texture)
 		{
 			out_.push_back(src_.source);
 		}
@@ -9,6 +9,7 @@
 #define ZEN_TEXTURES_SYSTEMS_TEXTURE_HPP
 
 #include "../../ecs/entity.hpp"
+#include <SDL2/SDL_render.h>
 #include <vector>
 #include <string>
 
@@ -23,6 +24,22 @@ namespace Zen {
  */
 Entity CreateTexture (std::string key, std::vector<std::string> sources);
 
+/**
+ * @overload
+ * @since 0.0.0
+ *
+ * @param key_ The unique key of the Texture.
+ * @param sdlTexture The SDL texture to use as the only source, the Texture
+ * takes ownership of it.
+ */
+Entity CreateTexture (std::string key, SDL_Texture *sdlTexture);
+
+/**
+ * Destroys a Texture along with its Frames and Sources, releasing their SDL
+ * textures.
+ *
+ * @since 0.0.0
+ */
 void DestroyTexture (Entity texture);
 
 /**
@@ -64,6 +81,36 @@ Entity AddFrame (Entity texture, std::string name, int sourceIndex, int x, int y
  */
 Entity AddFrame (Entity texture, int index, int sourceIndex, int x, int y, int width, int height);
 
+/**
+ * @overload
+ *
+ * Adds a Frame to a source already known, without looking it up by index.
+ *
+ * @since 0.0.0
+ *
+ * @param source The TextureSource of this Texture that this Frame is a part
+ * of.
+ * @param name The name of this Frame. The name is unique within the Texture.
+ * @param x The x coordinate of the top-left of this Frame.
+ * @param y The y coordinate of the top-left of this Frame.
+ * @param width The width of this Frame.
+ * @param height The height of this Frame.
+ *
+ * @return A pointer to the Frame that was added to this Texture, or `null`
+ * if the given name already exists.
+ */
+Entity AddFrame (Entity texture, Entity source, std::string name, int x, int y, int width, int height);
+
+/**
+ * Makes room in the Frame table of this Texture for the given number of
+ * Frames, before adding them all at once.
+ *
+ * @since 0.0.0
+ *
+ * @param count The number of Frames about to be added.
+ */
+void ReserveFrames (Entity texture, std::size_t count);
+
 /**
  * Removes the given Frame from this Texture. The Frame is destroyed
  * immediately.
@@ -119,6 +166,8 @@ bool HasFrame (Entity texture, int index);
  * In a Sprite Sheet Frames are referenced by an index.
  * Passing no value for the name returns the base texture.
  *
+ * Both are looked up in the Frame table of the Texture, not searched for.
+ *
  * @since 0.0.0
  *
  * @param name The name of the Frame to get from this Texture.
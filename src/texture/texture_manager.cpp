@@ -12,6 +12,7 @@
 #include "parsers/sprite_sheet.hpp"
 #include "parsers/sprite_sheet_atlas.hpp"
 
+#include <algorithm>
 #include <tuple>
 #include <utility>
 #include <fstream>
@@ -20,8 +21,11 @@
 #include "../window/window.hpp"
 #include "components/source.hpp"
 #include "components/frame.hpp"
+#include "../components/render_texture.hpp"
 #include "systems/texture.hpp"
 #include "systems/frame.hpp"
+#include "systems/source.hpp"
+#include "systems/alpha_mask.hpp"
 #include "../geom/rectangle.hpp"
 #include "../display/color.hpp"
 
@@ -30,15 +34,6 @@ namespace Zen {
 extern entt::registry g_registry;
 extern Window g_window;
 
-TextureManager::~TextureManager ()
-{
-	// Free surfaces
-	for (auto surface_ = alphaCache.begin(); surface_ != alphaCache.end(); surface_++)
-	{
-		SDL_FreeSurface(surface_->second);
-	}
-}
-
 void TextureManager::boot (GameConfig *config_)
 {
 	config = config_;
@@ -69,17 +64,14 @@ TextureManager& TextureManager::remove (std::string key_)
 		return *this;
 	}
 
-	for (auto it_ = list.begin(); it_ != list.end(); it_++)
-	{
-		if (it_->first == key_)
-		{
-			list.erase(it_);
+	auto it_ = list.find(key_);
+	Entity texture_ = it_->second;
 
-			emit("remove", key_);
+	list.erase(it_);
 
-			break;
-		}
-	}
+	emit("remove", key_);
+
+	DestroyTexture(texture_);
 
 	return *this;
 }
@@ -125,6 +117,9 @@ Entity TextureManager::addImage (std::string key_, std::string path_)
 				source_->width,
 				source_->height);
 
+		if (config->overdrawCulling)
+			computeOpacity(key_);
+
 		emit("add", key_);
 	}
 
@@ -133,34 +128,45 @@ Entity TextureManager::addImage (std::string key_, std::string path_)
 
 Entity TextureManager::addRenderTexture (std::string key_, Entity renderTexture_)
 {
-		/*
-		 * TODO
-	Texture *texture_ = nullptr;
+	Entity texture_ = entt::null;
 
-	if (checkKey(key_))
+	if (!checkKey(key_))
+		return texture_;
+
+	texture_ = create(key_, renderTexture_);
+
+	if (texture_ != entt::null)
 	{
-		texture_ = create(key_, renderTexture_);
+		auto& renderTextureComponent_ = g_registry.get<Components::RenderTexture>(renderTexture_);
 
-		 int sourceIndex_ = 0;
+		AddFrame(
+				texture_,
+				"__BASE",
+				0,
+				0,
+				0,
+				renderTextureComponent_.width,
+				renderTextureComponent_.height);
 
-		 texture_->add("__BASE",
-		 sourceIndex_,
-		 0,
-		 0,
-		 renderTexture_.width_,
-		 renderTexture_.height_);
+		renderTextureComponent_.key = key_;
 
-		 emit("add", key_);
+		emit("add", key_);
 	}
 
 	return texture_;
-		 */
-	return entt::null;
 }
 
 Entity TextureManager::addAtlas (
 		std::string key_, std::vector<std::string> sources_, std::string dataPath_)
 {
+	if (config->atlasCache)
+	{
+		AtlasBinary binary_;
+
+		if (OpenAtlasBinary(dataPath_, binary_))
+			return addAtlasBinary(key_, sources_, binary_);
+	}
+
 	// Open file
 	std::ifstream file_ (dataPath_);
 
@@ -177,6 +183,12 @@ Entity TextureManager::addAtlas (
 	// Close file
 	file_.close();
 
+	return addAtlasJSON(key_, sources_, data_);
+}
+
+Entity TextureManager::addAtlasJSON (
+		std::string key_, std::vector<std::string> sources_, nlohmann::json data_)
+{
 	auto texturesIt_ = data_.find("textures");
 	auto framesIt_ = data_.find("frames");
 
@@ -227,6 +239,9 @@ Entity TextureManager::addAtlasJSONArray (
 			return entt::null;
 	}
 
+	if (config->overdrawCulling)
+		computeOpacity(key_);
+
 	emit("add", key_);
 
 	return texture_;
@@ -244,6 +259,9 @@ Entity TextureManager::addAtlasJSONHash (
 		if ( ParseJsonHash(texture_, 0, data_) )
 			return entt::null;
 
+		if (config->overdrawCulling)
+			computeOpacity(key_);
+
 		emit("add", key_);
 	}
 
@@ -265,12 +283,34 @@ Entity TextureManager::addAtlasJSONHash (
 				return entt::null;
 		}
 
+		if (config->overdrawCulling)
+			computeOpacity(key_);
+
 		emit("add", key_);
 	}
 
 	return texture_;
 }
 
+Entity TextureManager::addAtlasBinary (
+		std::string key_, std::vector<std::string> sources_, const AtlasBinary& binary_)
+{
+	if (!checkKey(key_))
+		return entt::null;
+
+	Entity texture_ = create(key_, sources_);
+
+	if ( ParseAtlasBinary(texture_, binary_) )
+		return entt::null;
+
+	if (config->overdrawCulling)
+		computeOpacity(key_);
+
+	emit("add", key_);
+
+	return texture_;
+}
+
 Entity TextureManager::addSpriteSheet (std::string key_, std::string path_, SpriteSheetConfig config_)
 {
 	Entity texture_ = entt::null;
@@ -299,6 +339,9 @@ Entity TextureManager::addSpriteSheet (std::string key_, std::string path_, Spri
 	if ( ParseSpriteSheet(texture_, 0, 0, 0, width_, height_, config_) )
 		return entt::null;
 
+	if (config->overdrawCulling)
+		computeOpacity(key_);
+
 	emit("add", key_);
 
 	return texture_;
@@ -344,6 +387,9 @@ Entity TextureManager::addSpriteSheetFromAtlas (std::string key_, SpriteSheetCon
 			return entt::null;
 	}
 
+	if (config->overdrawCulling)
+		computeOpacity(key_);
+
 	emit("add", key_);
 
 	return texture_;
@@ -377,8 +423,26 @@ Entity TextureManager::create (std::string key_, std::string source_)
 
 Entity TextureManager::create (std::string key_, Entity renderTexture_)
 {
-	// TODO
-	return entt::null;
+	Entity texture_ = entt::null;
+
+	auto renderTextureComponent_ = g_registry.try_get<Components::RenderTexture>(renderTexture_);
+
+	if (!renderTextureComponent_)
+	{
+		MessageError("The entity has no 'RenderTexture' component.");
+
+		return texture_;
+	}
+
+	if (checkKey(key_))
+	{
+		texture_ = CreateTexture(key_, renderTextureComponent_->texture);
+
+		if (texture_ != entt::null)
+			list.emplace(key_, texture_);
+	}
+
+	return texture_;
 }
 
 bool TextureManager::exists (std::string key_)
@@ -415,7 +479,12 @@ Entity TextureManager::getFrame (std::string key_, std::string frame_)
 
 Entity TextureManager::getFrame (std::string key_, int frame_)
 {
-	return getFrame(key_, std::to_string(frame_));
+	auto textureIterator_ = list.find(key_);
+
+	if (textureIterator_ == list.end())
+		return entt::null;
+
+	return GetFrame(textureIterator_->second, frame_);
 }
 
 std::vector<std::string> TextureManager::getTextureKeys ()
@@ -455,6 +524,9 @@ Color TextureManager::getPixel (int x_, int y_, std::string key_, std::string fr
 			int pitch_ = 0;
 
 			// Get the frame's source SDL texture
+			// Loaded again if it was released
+			RestoreTextureSource(frame_->source);
+
 			auto& source_ = g_registry.get<Components::TextureSource>(frame_->source);
 			SDL_Texture *texture_ = source_.sdlTexture;
 
@@ -524,9 +596,9 @@ int TextureManager::getPixelAlpha (int x_, int y_, Entity textureFrame_)
 	{
 		auto& frame_ = g_registry.get<Components::Frame>(textureFrame_);
 
-		auto cache_ = alphaCache.find(frame_.source);
+		auto mask_ = g_registry.try_get<Components::AlphaMask>(frame_.source);
 
-		if (cache_ == alphaCache.end())
+		if (!mask_)
 		{
 			auto& src_ = g_registry.get<Components::TextureSource>(frame_.source);
 			auto& txt_ = g_registry.get<Components::Texture>(src_.texture);
@@ -535,12 +607,6 @@ int TextureManager::getPixelAlpha (int x_, int y_, Entity textureFrame_)
 			return -1;
 		}
 
-		if (alphaCache[frame_.source] == nullptr)
-		{
-			MessageError("No surface is present in the requested alpha cache.");
-			return -1;
-		}
-
 		// Adjust for trim (if not trimmed x and y are just zero)
 		x_ -= frame_.x;
 		y_ -= frame_.y;
@@ -552,21 +618,7 @@ int TextureManager::getPixelAlpha (int x_, int y_, Entity textureFrame_)
 
 		if (x_ >= data_.x && x_ < GetRight(data_) && y_ >= data_.y && y_ < GetBottom(data_))
 		{
-			// Get pixels in unsigned int of 32 bits
-			Uint32 *upixels_ = static_cast<Uint32*>(cache_->second->pixels);
-
-			// Read the pixel in `x` and `y`
-			Uint32 pixel_ = upixels_[y_ * (cache_->second->pitch/4) + x_];
-
-			// Get the color components of the pixel
-			Uint8 r_ = 0;
-			Uint8 g_ = 0;
-			Uint8 b_ = 0;
-			Uint8 a_ = 0;
-			SDL_GetRGBA(pixel_, cache_->second->format, &r_, &g_, &b_, &a_);
-
-			// Save the color components to the output variable
-			out_ = a_;
+			out_ = GetAlphaMaskValue(*mask_, x_, y_);
 		}
 	}
 
@@ -597,6 +649,9 @@ int TextureManager::getPixelAlpha (int x_, int y_, Entity textureFrame_)
 			int pitch_ = 0;
 
 			// Get the frame's source SDL texture
+			// Loaded again if it was released
+			RestoreTextureSource(frame_.source);
+
 			auto& source_ = g_registry.get<Components::TextureSource>(frame_.source);
 			SDL_Texture *texture_ = source_.sdlTexture;
 
@@ -664,25 +719,188 @@ int TextureManager::getPixelAlpha (int x_, int y_, std::string key_, int frameIn
 
 void TextureManager::createAlphaCache (std::string key_)
 {
-	// Get texture entity
 	Entity texture_ = get(key_);
 
-	// Get _ALL_ image files (Multi Atlases have many sources)
-	std::vector<Entity> sources_ = GetTextureSources(texture_);
+	if (texture_ == entt::null)
+		return;
 
-	// For each image:
-	for (auto& source_ : sources_)
+	// Multi Atlases have many sources
+	for (auto source_ : GetTextureSources(texture_))
 	{
 		auto& src_ = g_registry.get<Components::TextureSource>(source_);
 
-		// Create a surface
-		alphaCache[source_] = IMG_Load(src_.source.c_str());
+		SDL_Surface *surface_ = DecodeTextureSource(src_.source);
 
-		if (alphaCache[source_] == nullptr)
+		if (!surface_)
 		{
-			MessageError("Unable to load image ", src_.source.c_str(), ": ", IMG_GetError());
-			return;
+			MessageError("Unable to load image ", src_.source, ": ", IMG_GetError());
+			continue;
 		}
+
+		g_registry.emplace_or_replace<Components::AlphaMask>(source_, CreateAlphaMask(
+					surface_, config->alphaMaskDepth, static_cast<Uint8>(config->alphaMaskThreshold)));
+
+		SDL_FreeSurface(surface_);
+	}
+}
+
+void TextureManager::createAlphaCache (std::string key_, std::vector<Components::AlphaMask> masks_)
+{
+	Entity texture_ = get(key_);
+
+	if (texture_ == entt::null)
+		return;
+
+	for (auto source_ : GetTextureSources(texture_))
+	{
+		auto& src_ = g_registry.get<Components::TextureSource>(source_);
+
+		if (src_.index >= 0 && static_cast<std::size_t>(src_.index) < masks_.size() &&
+			!masks_[src_.index].data.empty())
+			g_registry.emplace_or_replace<Components::AlphaMask>(source_, std::move(masks_[src_.index]));
+	}
+}
+
+void TextureManager::enforceBudget (Uint64 frame_)
+{
+	if (!config->textureBudget)
+		return;
+
+	std::size_t budget_ = static_cast<std::size_t>(config->textureBudget) * 1024 * 1024;
+	std::size_t resident_ = 0;
+
+	evictionCandidates.clear();
+
+	for (auto entity_ : g_registry.view<Components::TextureSource>())
+	{
+		auto& src_ = g_registry.get<Components::TextureSource>(entity_);
+
+		if (!src_.sdlTexture)
+			continue;
+
+		resident_ += src_.bytes;
+
+		if (src_.reloadable && src_.lastUsed < frame_)
+			evictionCandidates.emplace_back(entity_);
+	}
+
+	if (resident_ <= budget_)
+		return;
+
+	// Least recently drawn first, the largest first among them
+	std::sort(evictionCandidates.begin(), evictionCandidates.end(),
+			[] (Entity a_, Entity b_) {
+				auto& srcA_ = g_registry.get<Components::TextureSource>(a_);
+				auto& srcB_ = g_registry.get<Components::TextureSource>(b_);
+
+				if (srcA_.lastUsed != srcB_.lastUsed)
+					return srcA_.lastUsed < srcB_.lastUsed;
+
+				return srcA_.bytes > srcB_.bytes;
+			});
+
+	for (auto entity_ : evictionCandidates)
+	{
+		if (resident_ <= budget_)
+			break;
+
+		std::size_t bytes_ = g_registry.get<Components::TextureSource>(entity_).bytes;
+
+		if (EvictTextureSource(entity_))
+		{
+			resident_ -= bytes_;
+			evictionCount++;
+		}
+	}
+}
+
+TextureMemory TextureManager::getMemory (std::string key_)
+{
+	TextureMemory memory_;
+
+	auto it_ = list.find(key_);
+
+	if (it_ == list.end())
+		return memory_;
+
+	for (auto entity_ : g_registry.view<Components::TextureSource>())
+	{
+		auto& src_ = g_registry.get<Components::TextureSource>(entity_);
+
+		if (src_.texture != it_->second)
+			continue;
+
+		if (src_.sdlTexture)
+		{
+			memory_.residentBytes += src_.bytes;
+			memory_.residentSources++;
+		}
+		else if (src_.evicted)
+		{
+			memory_.evictedBytes += src_.bytes;
+			memory_.evictedSources++;
+		}
+
+		memory_.lastUsed = std::max(memory_.lastUsed, src_.lastUsed);
+
+		if (auto mask_ = g_registry.try_get<Components::AlphaMask>(entity_))
+			memory_.alphaMaskBytes += mask_->data.size();
+	}
+
+	return memory_;
+}
+
+std::map<std::string, TextureMemory> TextureManager::getMemory ()
+{
+	std::map<std::string, TextureMemory> out_;
+
+	for (auto& [key_, texture_] : list)
+		out_.emplace(key_, getMemory(key_));
+
+	return out_;
+}
+
+std::size_t TextureManager::getResidentBytes ()
+{
+	std::size_t bytes_ = 0;
+
+	for (auto entity_ : g_registry.view<Components::TextureSource>())
+	{
+		auto& src_ = g_registry.get<Components::TextureSource>(entity_);
+
+		if (src_.sdlTexture)
+			bytes_ += src_.bytes;
+	}
+
+	return bytes_;
+}
+
+void TextureManager::computeOpacity (std::string key_)
+{
+	Entity texture_ = get(key_);
+
+	if (texture_ == entt::null)
+		return;
+
+	for (auto source_ : GetTextureSources(texture_))
+	{
+		// Made when the image was decoded. Render textures and failed loads
+		// are never opaque
+		auto opacity_ = g_registry.try_get<Components::OpacityMask>(source_);
+
+		if (!opacity_)
+			continue;
+
+		for (auto frameEntity_ : GetFramesFromSource(source_, true))
+		{
+			auto& frame_ = g_registry.get<Components::Frame>(frameEntity_);
+
+			frame_.opaque = IsAlphaMaskFull(*opacity_,
+					frame_.cutX, frame_.cutY, frame_.cutWidth, frame_.cutHeight);
+		}
+
+		// Not needed once the frames are known
+		g_registry.remove<Components::OpacityMask>(source_);
 	}
 }
 
@@ -20,7 +20,10 @@
 #include "../event/event_emitter.hpp"
 #include "../display/types/color.hpp"
 #include "sprite_sheet_config.hpp"
+#include "texture_memory.hpp"
 #include "components/texture.hpp"
+#include "components/alpha_mask.hpp"
+#include "parsers/atlas_binary.hpp"
 
 #include "../core/config.fwd.hpp"
 
@@ -37,8 +40,6 @@ namespace Zen {
 class TextureManager : public EventEmitter
 {
 public:
-	~TextureManager ();
-
 	/**
 	 * The boot handler called by the Game instance when it first starts up.
 	 *
@@ -103,7 +104,8 @@ public:
 	 * @since 0.0.0
 	 *
 	 * @param key_ The unique key of the Texture.
-	 * @param renderTexture_ The source Render Texture.
+	 * @param renderTexture_ The source Render Texture, an entity with a
+	 * `RenderTexture` component. Its key is set to `key_`.
 	 *
 	 * @return A pointer to the newly created Texture, or `nullptr` if the key
 	 * is already in use.
@@ -155,6 +157,21 @@ public:
 	 */
 	Entity addAtlasJSONArray (std::string key_, std::vector<std::string> sources_, nlohmann::json data_);
 
+	/**
+	 * Adds a Texture Atlas to this TextureManager, from its already parsed
+	 * data, stored either as a JSON Array or as a JSON Hash.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param key_ The unique key of the Texture.
+	 * @param sources_ The paths to the image files.
+	 * @param data_ The Texture Atlas data.
+	 *
+	 * @return A pointer to the newly created Texture, or `nullptr` if the key
+	 * is already in use.
+	 */
+	Entity addAtlasJSON (std::string key_, std::vector<std::string> sources_, nlohmann::json data_);
+
 	/**
 	 * Adds a Texture Atlas to this TextureManager.
 	 * The frame data of the atlas must be stored in an Object within the JSON.
@@ -187,6 +204,21 @@ public:
 	 */
 	Entity addAtlasJSONHash (std::string key_, std::vector<std::string> sources_, std::vector<nlohmann::json> data_);
 
+	/**
+	 * Adds a Texture Atlas to this TextureManager, from a binary atlas file
+	 * mapped in memory.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param key_ The unique key of the Texture.
+	 * @param sources_ The paths to the image files.
+	 * @param binary_ The mapped binary atlas.
+	 *
+	 * @return A pointer to the newly created Texture, or `nullptr` if the key
+	 * is already in use.
+	 */
+	Entity addAtlasBinary (std::string key_, std::vector<std::string> sources_, const AtlasBinary& binary_);
+
 	/**
 	 * Adds a Sprite Sheet to this TextureManager.
 	 *
@@ -247,7 +279,8 @@ public:
 	Entity create (std::string key_, std::string source_);
 
 	/**
-	 * @todo Create texture from renderTexture game object.
+	 * Creates a Texture whose only source is the texture of a Render Texture.
+	 * The Texture Manager takes ownership of it.
 	 *
 	 * @overload
 	 * @since 0.0.0
@@ -361,6 +394,9 @@ public:
 	 * return a value between 0 and 255 corresponding to the alpha value
 	 * of the pixel at that location in the Texture.
 	 *
+	 * The value is read from the alpha mask of the source, see
+	 * `createAlphaCache`. A 1-bit mask reads as `255` or `0`.
+	 *
 	 * This will return `-1` in case the coordinates are out of bounds.
 	 *
 	 * @since 0.0.0
@@ -397,8 +433,86 @@ public:
 	 */
 	int getPixelAlpha (int x_, int y_, std::string key_, int frameIndex_);
 
+	/**
+	 * Builds the alpha masks of the sources of a texture, read by
+	 * `getPixelAlpha`.
+	 *
+	 * The images are decoded again, packed as set by
+	 * `GameConfig::setAlphaMask`, and freed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param key_ The unique key of the Texture.
+	 */
 	void createAlphaCache (std::string key_);
 
+	/**
+	 * @overload
+	 * @since 0.0.0
+	 *
+	 * @param key_ The unique key of the Texture.
+	 * @param masks_ The alpha masks already built, by source index.
+	 */
+	void createAlphaCache (std::string key_, std::vector<Components::AlphaMask> masks_);
+
+	/**
+	 * Flags the frames of a texture whose pixels are all fully opaque, so
+	 * that the Renderer can skip what they cover.
+	 *
+	 * The opaque pixels are read from the images when they are decoded, and
+	 * released here. This runs for every texture added when
+	 * `GameConfig::overdrawCulling` is set.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param key_ The unique key of the Texture.
+	 */
+	void computeOpacity (std::string key_);
+
+	/**
+	 * Releases the least recently drawn textures loaded from files, until
+	 * the textures fit in `GameConfig::textureBudget`. They are loaded again
+	 * from their files the next time they are drawn.
+	 *
+	 * The textures drawn in the given frame are kept. Called by the Game
+	 * once a frame is rendered.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param frame_ The frame of the renderer that was just rendered.
+	 */
+	void enforceBudget (Uint64 frame_);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param key_ The unique key of the Texture.
+	 *
+	 * @return The texture memory used by the Texture.
+	 */
+	TextureMemory getMemory (std::string key_);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The texture memory used by each Texture, by key.
+	 */
+	std::map<std::string, TextureMemory> getMemory ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The size of all the SDL textures loaded, in bytes.
+	 */
+	std::size_t getResidentBytes ();
+
+	/**
+	 * The number of textures released by `enforceBudget` since the start.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t evictionCount = 0;
+
 	/*
 	 * Changes the key being used by a Texture to the new key provided.
 	 *
@@ -465,11 +579,11 @@ private:
 	std::map<std::string, Entity> list;
 
 	/**
-	 * TextureSource - Pixel array
+	 * The Sources `enforceBudget` can release, kept between frames.
 	 *
 	 * @since 0.0.0
 	 */
-	std::map<Entity, SDL_Surface*> alphaCache;
+	std::vector<Entity> evictionCandidates;
 };
 
 }	// namespace Zen
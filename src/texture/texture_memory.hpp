@@ -0,0 +1,61 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_TEXTURES_TEXTURE_MEMORY_HPP
+#define ZEN_TEXTURES_TEXTURE_MEMORY_HPP
+
+#include <SDL2/SDL_stdinc.h>
+#include <cstddef>
+
+namespace Zen {
+
+/**
+ * The texture memory used by a Texture, over all of its Sources.
+ *
+ * @struct TextureMemory
+ * @since 0.0.0
+ */
+struct TextureMemory
+{
+	/**
+	 * The size of the SDL textures loaded, in bytes.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t residentBytes = 0;
+
+	/**
+	 * The size of the SDL textures released to stay within the texture
+	 * budget, in bytes.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t evictedBytes = 0;
+
+	/**
+	 * The size of the alpha masks kept for pixel-perfect hit tests, in
+	 * bytes.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t alphaMaskBytes = 0;
+
+	int residentSources = 0;
+
+	int evictedSources = 0;
+
+	/**
+	 * The last frame of the renderer any of the Sources was drawn in.
+	 *
+	 * @since 0.0.0
+	 */
+	Uint64 lastUsed = 0;
+};
+
+}	// namespace Zen
+
+#endif
@@ -11,6 +11,7 @@
 #include "types/tween_config.hpp"
 #include "../ecs/entity.hpp"
 #include "../scene/scene.hpp"
+#include "../systems/dirty.hpp"
 
 namespace Zen {
 
@@ -108,6 +109,10 @@ void TweenManager::update (Uint32 time_, Uint32 delta_)
 	// Scale the delta
 	delta_ *= timeScale;
 
+	// A running Tween changes the next frame, even while it is delayed
+	if (!active.empty())
+		MarkFrameDirty();
+
 	for (auto& tween_ : active)
 	{
 		// If Tween::update returns 'true' then it means it has completed,
@@ -53,7 +53,7 @@ int Window::create (GameConfig *cfg)
 		cleanup(WINDOW_CLEANUP::TTF, WINDOW_CLEANUP::IMG, WINDOW_CLEANUP::SDL);
 		return 1;
 	} else if (createRenderer()) {
-		cleanup(window, WINDOW_CLEANUP::TTF, WINDOW_CLEANUP::IMG, WINDOW_CLEANUP::SDL);
+		cleanup(surface, window, WINDOW_CLEANUP::TTF, WINDOW_CLEANUP::IMG, WINDOW_CLEANUP::SDL);
 		return 1;
 	} else {
 		// Everything has gone well
@@ -72,6 +72,10 @@ int Window::create (GameConfig *cfg)
 
 int Window::initSdl ()
 {
+	// The headless backends must run without a display
+	if (config->renderBackend != RENDER_BACKEND::ACCELERATED)
+		SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+
 	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
 		MessageError("Could not initialize SDL: %s\n", SDL_GetError());
 		return 1;
@@ -112,7 +116,9 @@ int Window::createWindow ()
 			SDL_WINDOWPOS_UNDEFINED,
 			config->width,
 			config->height,
-			SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE
+			(config->renderBackend == RENDER_BACKEND::ACCELERATED) ?
+				SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE :
+				SDL_WINDOW_HIDDEN
 			);
 	if (window == nullptr) {
 		MessageError("Window could not be created: %s\n", SDL_GetError());
@@ -124,14 +130,31 @@ int Window::createWindow ()
 
 int Window::createRenderer ()
 {
-	// Create a renderer for the window
-	renderer = SDL_CreateRenderer(
-			window,
-			-1,
-			SDL_RENDERER_ACCELERATED |
-			SDL_RENDERER_PRESENTVSYNC |
-			SDL_RENDERER_TARGETTEXTURE
-			);
+	if (config->renderBackend == RENDER_BACKEND::ACCELERATED) {
+		// Create a renderer for the window
+		renderer = SDL_CreateRenderer(
+				window,
+				-1,
+				SDL_RENDERER_ACCELERATED |
+				SDL_RENDERER_PRESENTVSYNC |
+				SDL_RENDERER_TARGETTEXTURE
+				);
+	} else {
+		// Draw offscreen, in the pixel format of the window
+		surface = SDL_CreateRGBSurfaceWithFormat(
+				0,
+				config->width,
+				config->height,
+				32,
+				SDL_PIXELFORMAT_ARGB8888
+				);
+		if (surface == nullptr) {
+			MessageError("Offscreen surface could not be created: %s\n", SDL_GetError());
+			return 1;
+		}
+
+		renderer = SDL_CreateSoftwareRenderer(surface);
+	}
 	if (renderer == nullptr) {
 		MessageError("Renderer could not be created: %s\n", SDL_GetError());
 		return 1;
@@ -163,12 +186,14 @@ int Window::close ()
 	// running this!
 	cleanup(
 			renderer,
+			surface,
 			window,
 			WINDOW_CLEANUP::TTF,
 			WINDOW_CLEANUP::IMG,
 			WINDOW_CLEANUP::SDL
 		   );
 	renderer = nullptr;
+	surface = nullptr;
 	window = nullptr;
 
 	return 0;
@@ -217,6 +242,14 @@ void Window::cleanup<SDL_Renderer*> (SDL_Renderer *ren_)
 	SDL_DestroyRenderer(ren_);
 }
 
+template<>
+void Window::cleanup<SDL_Surface*> (SDL_Surface *surface_)
+{
+	if (!surface_) return;
+
+	SDL_FreeSurface(surface_);
+}
+
 void Window::handleSDLEvents (SDL_Event event_)
 {
 	switch (event_.window.event)
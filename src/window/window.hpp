@@ -60,6 +60,14 @@ public:
 	 */
 	SDL_Renderer *renderer = nullptr;
 
+	/**
+	 * The offscreen surface the software renderer draws to, or `nullptr`
+	 * when rendering to the window.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Surface *surface = nullptr;
+
 	/**
 	 * Getter for the window's width.
 	 *
@@ -148,7 +156,8 @@ public:
 	int createWindow ();
 
 	/**
-	 * This method creates a renderer for the window.
+	 * This method creates a renderer for the window, or for an offscreen
+	 * surface if the render backend is a headless one.
 	 *
 	 * @since 0.0.0
 	 *
@@ -182,6 +191,7 @@ public:
 	 * - WINDOW_CLEANUP (Enum Class)
 	 * - SDL_Window
 	 * - SDL_Renderer
+	 * - SDL_Surface
 	 *
 	 * It will then take appropriate actions depending on the type of each
 	 * parameter.